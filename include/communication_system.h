@@ -5,6 +5,20 @@
 
 #define MAX_CONNECTED_PLAYERS 8
 
+#ifdef COMM_SEND_STATS
+typedef struct CommSendStats {
+    u32 frames;
+    u32 queuedCommands;
+    u32 droppedSends; // commands refused because the send queue or ring was full
+    u32 retriedSends; // packets the driver refused, to be sent again next frame
+    u32 curFrameBytes;
+    u32 lastFrameBytes;
+    u32 peakFrameBytes;
+    u32 queueDepth; // commands still pending at the end of the last frame
+    u32 peakQueueDepth;
+} CommSendStats;
+#endif
+
 BOOL CommSys_InitServer(BOOL param0, BOOL param1, int param2, BOOL param3);
 BOOL CommSys_InitClient(BOOL param0, BOOL param1, int param2);
 void CommSys_SwitchTransitionTypeToParallel(void);
@@ -41,6 +55,10 @@ void CommSys_DisableSendMovementData(void);
 BOOL CommSys_IsSendingMovementData(void);
 BOOL CommSys_WriteToQueueServer(int cmd, const void *data, int param2);
 BOOL CommSys_WriteToQueue(int cmd, const void *data, int param2);
+#ifdef COMM_SEND_STATS
+void CommSys_GetSendStats(CommSendStats *stats);
+void CommSys_ResetSendStats(void);
+#endif
 void sub_02036008(int unused0, int unused1, void *param2, void *unused3);
 void sub_02036030(int unused0, int unused1, void *param2, void *unused3);
 void sub_02036058(int unused0, int unused1, void *param2, void *unused3);
@@ -39,7 +39,8 @@ enum HeapSize {
     HEAP_SIZE_SYSTEM = 0xD200,
     HEAP_SIZE_SAVE = 0x20E00,
     HEAP_SIZE_DEBUG = 0x10,
-    HEAP_SIZE_APPLICATION = 0x10D800,
+    // 0x5800 of this holds the tables and caches NitroMain keeps resident
+    HEAP_SIZE_APPLICATION = 0x113000,
 
     HEAP_SIZE_PRE_POKETCH_SUBSCREEN = 0x18000,
     HEAP_SIZE_POKETCH_MAIN = 0xC000,
@@ -43,6 +43,7 @@ void Font_UseLazyGlyphAccess(enum Font font);
 void Font_Free(enum Font font);
 const TextGlyph *Font_TryLoadGlyph(enum Font font, charcode_t c);
 enum RenderResult Font_RenderText(enum Font font, TextPrinter *printer);
+enum RenderResult Font_RenderTextInstant(enum Font font, TextPrinter *printer, u32 *steps, u32 maxSteps);
 u32 Font_CalcStringWidth(enum Font font, const charcode_t *str, u32 letterSpacing);
 u32 Font_CalcStrbufWidth(enum Font font, const Strbuf *strbuf, u32 letterSpacing);
 u32 Font_AreAllCharsValid(enum Font font, Strbuf *strbuf, Strbuf *tmpbuf);
@@ -3,16 +3,36 @@
 
 #include <nitro/fs.h>
 
+#define OVERLAY_LOAD_RECORD_COUNT 8
+
 typedef enum OverlayLoadType {
     OVERLAY_LOAD_NORMAL,
     OVERLAY_LOAD_NOINIT,
-    OVERLAY_LOAD_ASYNC
+    OVERLAY_LOAD_ASYNC,
 } OverlayLoadType;
 
+// Timing of one Overlay_LoadByID call, in OS ticks. prefetchTicks is how far
+// ahead of the load the image started streaming in, if it was prefetched.
+typedef struct OverlayLoadRecord {
+    FSOverlayID overlayID;
+    u32 loadTicks;
+    u32 prefetchTicks;
+    BOOL prefetched;
+} OverlayLoadRecord;
+
 void Overlay_UnloadByID(const FSOverlayID overlayID);
 int Overlay_GetLoadDestination(const FSOverlayID overlayID);
 BOOL Overlay_LoadByID(const FSOverlayID overlayID, enum OverlayLoadType loadType);
 
+// Start streaming an overlay's image into its RAM region ahead of the
+// Overlay_LoadByID call that will need it. Returns FALSE if the region is
+// still in use; the later load then simply happens synchronously.
+BOOL Overlay_Prefetch(const FSOverlayID overlayID);
+void Overlay_CancelPrefetch(void);
+
+// Most recent load is age 0; returns NULL past the recorded history.
+const OverlayLoadRecord *Overlay_GetLoadRecord(u32 age);
+
 #ifdef GDB_DEBUGGING
 // describes a single overlay entry, which GDB can inspect to determine which overlays are loaded.
 typedef struct {
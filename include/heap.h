@@ -21,4 +21,14 @@ void Heap_FndInitAllocatorForExpHeap(NNSFndAllocator *pAllocator, u32 heapID, in
 void Heap_ReallocFromHeap(void *ptr, u32 newSize);
 BOOL GF_heap_c_dummy_return_true(u32 heapID);
 
+#ifdef HEAP_TRACING
+// Writes per-heap statistics and the busiest allocation sites as text lines,
+// for tools/debug/summarize_heap_trace.py. Returns the number of bytes written.
+u32 Heap_TraceDump(char *buf, u32 bufSize);
+// Called once per frame; prints the dump through OS_Printf every 600 frames.
+// The counts are cumulative until Heap_TraceReset is called.
+void Heap_TraceUpdate(void);
+void Heap_TraceReset(void);
+#endif
+
 #endif // POKEPLATINUM_UNK_02017E74_H
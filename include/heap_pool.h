@@ -0,0 +1,24 @@
+#ifndef POKEPLATINUM_HEAP_POOL_H
+#define POKEPLATINUM_HEAP_POOL_H
+
+// A fixed number of same-sized slots carved out of one heap allocation.
+// Slots are handed out and returned in constant time through an intrusive
+// free list, without the expanded heap's search or per-block header.
+typedef struct HeapPool {
+    u32 heapID;
+    u32 slotSize;
+    u32 numSlots;
+    void *freeList;
+    u8 *slots;
+    u8 *slotsEnd;
+} HeapPool;
+
+HeapPool *HeapPool_New(u32 heapID, u32 slotSize, u32 numSlots);
+
+// Returns NULL once every slot is in use; callers are expected to fall back
+// to Heap_AllocFromHeap in that case.
+void *HeapPool_Alloc(HeapPool *pool);
+void HeapPool_Free(HeapPool *pool, void *ptr);
+BOOL HeapPool_Contains(const HeapPool *pool, const void *ptr);
+
+#endif // POKEPLATINUM_HEAP_POOL_H
@@ -220,6 +220,8 @@ void Item_LoadDescription(Strbuf *dst, u16 item, u16 heapID);
 /**
  * @brief Load a parameter for a given item from the data archive.
  *
+ * Answered from memory when the resident item table is loaded.
+ *
  * @param item      The item to load.
  * @param param     The param to load from the item.
  * @param heapID    The heap on which to load the item data.
@@ -337,4 +339,15 @@ void *ItemTable_Load(int heapID);
  */
 ItemData *ItemTable_Index(ItemData *itemTable, u16 index);
 
+/**
+ * @brief Keep the full table of item data resident so that Item_LoadParam
+ * can answer queries without touching the filesystem.
+ *
+ * The table costs one ItemData per item data record and is bounded by a
+ * fixed budget. It is loaded once at boot and never freed.
+ *
+ * @param heapID    The heap which will own the resident table.
+ */
+void ItemTable_LoadResident(u32 heapID);
+
 #endif // POKEPLATINUM_ITEM_DATA_H
@@ -170,6 +170,17 @@ u32 MessageBank_NARCEntryCount(u32 narcID, u32 bankID);
  */
 MessageLoader *MessageLoader_Init(enum MessageLoaderType type, u32 narcID, u32 bankID, u32 heapID);
 
+/**
+ * @brief Set aside a small pool of MessageLoader structs so that short-lived
+ * loaders do not have to be allocated from the caller's heap.
+ *
+ * Loaders fall back to the caller's heap when all pool slots are in use.
+ * The pool is set up once at boot and is never freed.
+ *
+ * @param heapID    The heap which will own the pool.
+ */
+void MessageLoader_InitPool(u32 heapID);
+
 /**
  * @brief Free a MessageLoader struct back to its owning heap.
  *
@@ -222,4 +233,27 @@ void MessageLoader_Get(const MessageLoader *loader, u32 entryID, charcode_t *dst
  */
 void MessageLoader_GetSpeciesName(u32 species, u32 heapID, charcode_t *dst);
 
+/**
+ * @brief Set up the shared message cache and open the pl_msg archive it reads
+ * from. Called once at boot; the cache stays resident for the whole session.
+ *
+ * @param heapID    The heap which will own the cache and the archive handle.
+ */
+void MessageCache_Init(u32 heapID);
+
+/**
+ * @brief Load a bank entry from pl_msg into the destination Strbuf struct
+ * through the shared message cache.
+ *
+ * The cache keeps the pl_msg archive open and holds the headers of recently
+ * used banks and recently decoded short strings, so repeated lookups of the
+ * same names do not go back to the filesystem.
+ *
+ * @param bankID    Index of the bank in pl_msg.
+ * @param entryID   The entry to be loaded from the bank.
+ * @param heapID    Heap for temporary buffers when a string is too long to cache.
+ * @param strbuf    Destination Strbuf struct.
+ */
+void MessageCache_GetStrbuf(u32 bankID, u32 entryID, u32 heapID, Strbuf *strbuf);
+
 #endif // POKEPLATINUM_MESSAGE_H
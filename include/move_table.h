@@ -33,6 +33,26 @@ typedef struct MoveTable {
  */
 void MoveTable_Load(void *buf);
 
+/**
+ * @brief Register a fully loaded move table as resident.
+ *
+ * While a table is registered, MoveTable_LoadParam reads from it instead of
+ * the move data archive. The table must hold every move, as filled in by
+ * MoveTable_Load, and must outlive the registration.
+ *
+ * @param table     The loaded move table.
+ */
+void MoveTable_SetResident(const MoveTable *table);
+
+/**
+ * @brief Unregister a resident move table.
+ *
+ * Does nothing if a different table has been registered since.
+ *
+ * @param table     The move table which is about to be freed.
+ */
+void MoveTable_ClearResident(const MoveTable *table);
+
 /**
  * @brief Load a param for a given move from the global move table.
  *
@@ -618,6 +618,25 @@ u16 Pokemon_SinnohDexNumber(u16 species);
  */
 u16 Pokemon_NationalDexNumber(u16 sinnohDexNumber);
 
+/**
+ * @brief Keeps the Sinnoh and National Pokedex number mappings resident, so that
+ * Pokemon_SinnohDexNumber and Pokemon_NationalDexNumber no longer read the archive
+ * on every lookup. Must only be called once, during boot.
+ *
+ * @param heapID The heap which will own the resident tables
+ */
+void Pokemon_LoadDexNumberTables(u32 heapID);
+
+/**
+ * @brief Gets a bitmask of the species which have a Sinnoh Pokedex number
+ *
+ * Bit (species - 1) is set for each such species, in the same layout as the
+ * seen and caught arrays of the Pokedex save data.
+ *
+ * @return The Sinnoh Pokedex membership mask
+ */
+const u32 *Pokemon_GetSinnohDexMask(void);
+
 void Pokemon_Copy(Pokemon *src, Pokemon *dest);
 void BoxPokemon_Copy(BoxPokemon *src, BoxPokemon *dest);
 void BoxPokemon_FromPokemon(Pokemon *src, BoxPokemon *dest);
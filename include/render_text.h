@@ -78,6 +78,8 @@ enum RenderResult {
 };
 
 enum RenderResult RenderText(TextPrinter *printer);
+enum RenderResult RenderTextInstant(TextPrinter *printer, u32 *steps, u32 maxSteps);
+BOOL RenderText_IsAtCharBoundary(const TextPrinter *printer);
 void TextPrinter_SetScrollArrowBaseTile(u16 tile);
 void TextPrinter_InitScrollArrowAnim(TextPrinter *printer);
 void TextPrinter_DrawScrollArrow(TextPrinter *printer);
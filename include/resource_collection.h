@@ -22,6 +22,8 @@ typedef struct ResourceCollection {
     Resource *resources;
     int capacity;
     int count;
+    s16 *index; // Open-addressed ID -> slot table, NULL for small collections
+    u32 indexMask;
 } ResourceCollection;
 
 typedef struct TextureResource {
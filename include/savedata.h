@@ -43,6 +43,9 @@ typedef struct SaveDataState {
     u32 globalCounterBackup;
     u32 blockCounterBackup[SAVE_BLOCK_ID_MAX];
     volatile BOOL locked;
+    u32 dirtySectors;
+    u32 pendingSectorKeys[SAVE_PAGE_MAX];
+    u32 bytesWritten;
 } SaveDataState;
 
 typedef struct SaveData {
@@ -60,6 +63,10 @@ typedef struct SaveData {
     SaveDataState state;
     int sectorSwitch;
     u32 sectorCounter;
+    u32 sectorKeys[SECTOR_ID_MAX][SAVE_PAGE_MAX]; // Contents of each sector of both copies on the card
+    u32 sectorKeysValid[SECTOR_ID_MAX];
+    u32 modifiedSectors[SECTOR_ID_MAX]; // Sectors handed out by SaveData_SaveTable since each copy was last written
+    u32 lastSaveSize;
 } SaveData;
 
 typedef struct SaveCheckInfo {
@@ -96,6 +103,7 @@ void SaveData_SetFullSaveRequired(void);
 void SaveData_SaveStateInit(SaveData *saveData, int blockID);
 int SaveData_SaveStateMain(SaveData *saveData);
 void SaveData_SaveStateCancel(SaveData *saveData);
+u32 SaveData_LastSaveSize(const SaveData *saveData);
 u16 SaveData_CalculateChecksum(const SaveData *saveData, const void *startAddress, u32 size);
 int SaveTableEntry_BodySize(int saveTableID);
 void SaveDataExtra_Init(SaveData *saveData);
@@ -14,6 +14,10 @@
 #define SPRITE_ANIM_SIZE 29
 #define MAX_SPRITES      128
 
+// Sprites with a priority below this are inserted through per-priority tail
+// pointers; one bit per bucket is kept in SpriteList.occupiedPriorities.
+#define SPRITE_LIST_PRIORITY_BUCKETS 32
+
 enum CellAnimType {
     CELL_ANIM_TYPE_NONE = 0,
     CELL_ANIM_TYPE_CELL,
@@ -93,6 +97,8 @@ struct SpriteList {
     void *rawAnimData;
     NNSG2dCellAnimBankData *defaultAnimBank;
     BOOL active;
+    Sprite *priorityTails[SPRITE_LIST_PRIORITY_BUCKETS]; // Last sprite in the list with each priority
+    u32 occupiedPriorities;
 };
 
 typedef struct SpriteListParams {
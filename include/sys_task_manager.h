@@ -10,6 +10,31 @@ enum TaskState {
     TASK_STATE_INACTIVE,
 };
 
+#ifdef SYS_TASK_PROFILING
+#define SYS_TASK_PROFILE_MAX_CALLBACKS    32
+#define SYS_TASK_PROFILE_REPORT_FRAMES    600
+#define SYS_TASK_PROFILE_REPORT_ENTRIES   8
+#define SYS_TASK_PROFILE_FRAME_BUDGET_US  16715 // One frame at 59.8261 Hz
+
+// Cost of every task run with the same callback, in OS ticks
+typedef struct SysTaskProfileEntry {
+    SysTaskFunc callback;
+    u32 calls;
+    u32 totalTicks;
+    u32 worstTicks;
+    u32 overBudgetFrames; // Frames over budget in which this was the heaviest task
+} SysTaskProfileEntry;
+
+typedef struct SysTaskProfile {
+    SysTaskProfileEntry entries[SYS_TASK_PROFILE_MAX_CALLBACKS];
+    u32 numEntries;
+    u32 droppedCalls; // Calls from callbacks that did not fit in the table
+    u32 frames;
+    u32 overBudgetFrames;
+    u32 worstFrameTicks;
+} SysTaskProfile;
+#endif // SYS_TASK_PROFILING
+
 typedef struct SysTask {
     SysTaskManager *manager;
     SysTask *prevTask;
@@ -20,15 +45,27 @@ typedef struct SysTask {
     enum TaskState state;
 } SysTask;
 
+// All live tasks sharing a priority sit next to each other in the task list
+typedef struct SysTaskPriorityGroup {
+    u32 priority;
+    SysTask *tail; // The last task with this priority, which new ones are added after
+    u32 count;
+} SysTaskPriorityGroup;
+
 typedef struct SysTaskManager {
     u16 maxTasks;
     u16 stackPointer;
     SysTask sentinelTask;
     SysTask **taskStack;
     SysTask *tasks;
+    SysTaskPriorityGroup *priorityGroups; // Sorted by priority
+    u32 numPriorityGroups;
     BOOL locked; // The task manager can't execute while a task is being added
     SysTask *currentTask; // The task that is currently being executed
     SysTask *nextTask; // The task that will be executed next
+#ifdef SYS_TASK_PROFILING
+    SysTaskProfile profile;
+#endif
 } SysTaskManager;
 
 u32 SysTaskManager_GetRequiredSize(u32 maxTasks);
@@ -41,4 +78,9 @@ void SysTask_SetCallback(SysTask *task, SysTaskFunc callback);
 void *SysTask_GetParam(SysTask *task);
 u32 SysTask_GetPriority(SysTask *task);
 
+#ifdef SYS_TASK_PROFILING
+void SysTaskManager_PrintProfile(SysTaskManager *sysTaskMgr);
+void SysTaskManager_ResetProfile(SysTaskManager *sysTaskMgr);
+#endif
+
 #endif // POKEPLATINUM_SYS_TASK_MANAGER_H
@@ -1,12 +1,17 @@
 #ifndef POKEPLATINUM_UNK_0200762C_H
 #define POKEPLATINUM_UNK_0200762C_H
 
+#include <nnsys.h>
+
 #include "struct_decls/struct_02007768_decl.h"
 #include "struct_defs/archived_sprite.h"
 #include "struct_defs/pokemon_sprite.h"
 #include "struct_defs/sprite_animation_frame.h"
 #include "struct_defs/struct_02008900.h"
 
+// Marks character data whose pixels were stored already decrypted
+#define CHARACTER_FMT_PREDECRYPTED (1 << 30)
+
 void *sub_0200762C(int param0);
 void sub_02007768(UnkStruct_02007768 *param0);
 void sub_02007B6C(UnkStruct_02007768 *param0);
@@ -43,5 +48,6 @@ void sub_020091D8(u8 *param0, u32 param1, BOOL param2);
 void sub_02009348(u8 *param0);
 void sub_02009370(u8 *param0);
 void sub_020093A0(u8 *param0, int param1);
+void PokemonSprite_DecryptCharacterData(NNSG2dCharacterData *charData, int narcID);
 
 #endif // POKEPLATINUM_UNK_0200762C_H
@@ -7,6 +7,9 @@
 #include "comm_ring.h"
 
 BOOL CommQueue_IsEmpty(CommQueueMan *param0);
+#ifdef COMM_SEND_STATS
+int CommQueue_NumPending(CommQueueMan *queue);
+#endif
 BOOL CommQueue_Write(CommQueueMan *param0, int param1, u8 *param2, int param3, BOOL param4, BOOL param5);
 BOOL sub_02032574(CommQueueMan *param0, UnkStruct_0203233C *param1, BOOL param2);
 void CommQueueMan_Init(CommQueueMan *param0, int param1, CommRing *param2);
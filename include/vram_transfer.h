@@ -3,9 +3,21 @@
 
 #include "constants/heap.h"
 
+typedef struct VramTransferStats {
+    u32 curBytes; // accepted so far this frame, before merging; drops are not counted
+    u32 lastFrameBytes;
+    u32 lastFrameTasks;
+    u32 peakBytes;
+    u32 peakTasks;
+    u32 mergedRequests;
+    u32 droppedRequests;
+} VramTransferStats;
+
 void VramTransfer_New(u32 capacity, enum HeapId heapID);
 void VramTransfer_Free(void);
 BOOL VramTransfer_Request(NNS_GFD_DST_TYPE type, u32 destAddr, void *buf, u32 size);
 void VramTransfer_Process(void);
+void VramTransfer_GetStats(VramTransferStats *stats);
+void VramTransfer_ResetStats(void);
 
 #endif // POKEPLATINUM_VRAM_TRANSFER_H
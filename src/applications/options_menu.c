@@ -342,7 +342,7 @@ static void OptionsMenuVBlank(void *data)
     }
 
     SpriteSystem_TransferOam();
-    NNS_GfdDoVramTransfer();
+    VramTransfer_Process();
     Bg_RunScheduledUpdates(menuData->bgConfig);
     OS_SetIrqCheckFlag(OS_IE_V_BLANK);
 }
@@ -20,6 +20,8 @@
 #define BAG_MAX_QUANTITY_ITEM 999
 #define BAG_MAX_QUANTITY_TMHM 99
 
+static BagItem sPocketScratch[ITEM_POCKET_SIZE];
+
 static u32 Bag_GetPocketForItem(Bag *bag, u16 item, BagItem **outPocket, u32 *outMax, enum HeapId heapID);
 
 int Bag_SaveSize(void)
@@ -292,33 +294,73 @@ u16 Pocket_GetItemQuantity(BagItem *pocket, u32 pocketSize, u16 item, enum HeapI
     return slot->quantity;
 }
 
-static void BagItem_Swap(BagItem *a, BagItem *b)
+/*
+ * Moves the filled slots to the front of the pocket in their current order and
+ * returns how many there are. The empty slots follow in reverse order, which is
+ * where the original exchange loop left them.
+ */
+static u32 Pocket_Compact(BagItem *pocket, const u32 size)
 {
-    BagItem temp = *a;
-    *a = *b;
-    *b = temp;
+    u32 i;
+    u32 numFilled = 0;
+    u32 numEmpty = 0;
+
+    GF_ASSERT(size <= ITEM_POCKET_SIZE);
+
+    for (i = 0; i < size; i++) {
+        if (pocket[i].quantity != 0) {
+            pocket[numFilled++] = pocket[i];
+        } else {
+            sPocketScratch[numEmpty++] = pocket[i];
+        }
+    }
+
+    for (i = 0; i < numEmpty; i++) {
+        pocket[numFilled + i] = sPocketScratch[numEmpty - 1 - i];
+    }
+
+    return numFilled;
 }
 
-void Pocket_SortEmpty(BagItem *pocket, const u32 size)
+static void Pocket_MergeSortByItem(BagItem *pocket, u32 size)
 {
-    for (u32 i = 0; i < size - 1; i++) {
-        for (u32 j = i + 1; j < size; j++) {
-            if (pocket[i].quantity == 0) {
-                BagItem_Swap(&pocket[i], &pocket[j]);
-            }
+    if (size < 2) {
+        return;
+    }
+
+    u32 half = size / 2;
+    Pocket_MergeSortByItem(pocket, half);
+    Pocket_MergeSortByItem(pocket + half, size - half);
+
+    if (pocket[half - 1].item <= pocket[half].item) {
+        return;
+    }
+
+    u32 left = 0, right = half, out = 0;
+
+    while (left < half && right < size) {
+        if (pocket[right].item < pocket[left].item) {
+            sPocketScratch[out++] = pocket[right++];
+        } else {
+            sPocketScratch[out++] = pocket[left++];
         }
     }
+
+    while (left < half) {
+        sPocketScratch[out++] = pocket[left++];
+    }
+
+    memcpy(pocket, sPocketScratch, out * sizeof(BagItem));
+}
+
+void Pocket_SortEmpty(BagItem *pocket, const u32 size)
+{
+    Pocket_Compact(pocket, size);
 }
 
 void Pocket_Sort(BagItem *pocket, const u32 size)
 {
-    for (u32 i = 0; i < size - 1; i++) {
-        for (u32 j = i + 1; j < size; j++) {
-            if (pocket[i].quantity == 0 || (pocket[j].quantity != 0 && pocket[i].item > pocket[j].item)) {
-                BagItem_Swap(&pocket[i], &pocket[j]);
-            }
-        }
-    }
+    Pocket_MergeSortByItem(pocket, Pocket_Compact(pocket, size));
 }
 
 void *sub_0207D824(Bag *bag, const u8 *pockets, enum HeapId heapID)
@@ -186,6 +186,7 @@ void *BattleContext_New(BattleSystem *battleSys)
     BattleController_InitAI(battleSys, battleContext);
 
     MoveTable_Load(&battleContext->aiContext.moveTable);
+    MoveTable_SetResident(battleContext->aiContext.moveTable);
     battleContext->aiContext.itemTable = ItemTable_Load(HEAP_ID_BATTLE);
 
     return battleContext;
@@ -210,6 +211,7 @@ BOOL BattleController_Main(BattleSystem *battleSys, BattleContext *battleCtx)
 
 void BattleContext_Free(BattleContext *battleCtx)
 {
+    MoveTable_ClearResident(battleCtx->aiContext.moveTable);
     Heap_FreeToHeap(battleCtx->aiContext.itemTable);
     Heap_FreeToHeap(battleCtx);
 }
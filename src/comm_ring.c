@@ -19,21 +19,28 @@ void CommRing_Init(CommRing *ring, u8 *buffer, int size)
 
 void CommRring_Write(CommRing *ring, u8 *buffer, int size, int unused)
 {
-    int i;
-
     if (CommRing_RemainingSizeBackup(ring) <= size) {
         sub_020363BC();
         return;
     }
 
-    int j = 0;
+    if (size <= 0) {
+        return;
+    }
+
+    GF_ASSERT(buffer);
+
+    int start = ring->backupEndIndex;
+    int firstSize = ring->size - start;
 
-    for (i = ring->backupEndIndex; i < ring->backupEndIndex + size; i++, j++) {
-        GF_ASSERT(buffer);
-        ring->buffer[CommRing_Index(ring, i)] = buffer[j];
+    if (firstSize > size) {
+        firstSize = size;
     }
 
-    ring->backupEndIndex = CommRing_Index(ring, i);
+    memcpy(&ring->buffer[start], buffer, firstSize);
+    memcpy(ring->buffer, &buffer[firstSize], size - firstSize);
+
+    ring->backupEndIndex = CommRing_Index(ring, start + size);
 }
 
 int CommRing_Read(CommRing *ring, u8 *buffer, int size)
@@ -55,17 +62,27 @@ u8 CommRing_ReadByte(CommRing *ring)
 // Reading but doesn't incriment the index
 int CommRing_Peek(CommRing *ring, u8 *buffer, int size)
 {
-    int j = 0;
+    int dataSize = CommRing_DataSize(ring);
 
-    for (int i = ring->startIndex; i < ring->startIndex + size; i++, j++) {
-        if (ring->endIndex == CommRing_Index(ring, i)) {
-            return j;
-        }
+    if (size > dataSize) {
+        size = dataSize;
+    }
 
-        buffer[j] = ring->buffer[CommRing_Index(ring, i)];
+    if (size <= 0) {
+        return 0;
     }
 
-    return j;
+    int start = ring->startIndex;
+    int firstSize = ring->size - start;
+
+    if (firstSize > size) {
+        firstSize = size;
+    }
+
+    memcpy(buffer, &ring->buffer[start], firstSize);
+    memcpy(&buffer[firstSize], ring->buffer, size - firstSize);
+
+    return size;
 }
 
 int CommRing_DataSize(CommRing *ring)
@@ -131,6 +131,11 @@ static BOOL sub_020356A0(u8 *param0, int param1);
 static BOOL sub_02035730(u8 *param0);
 static void CommSys_Transmission(void);
 static BOOL sub_0203594C(void);
+static BOOL CommSys_QueueCommand(CommQueueMan *queue, int cmd, u8 *data, int size, BOOL param4, BOOL copyToRing);
+static void CommSys_RecordSendRetry(void);
+#ifdef COMM_SEND_STATS
+static void CommSys_EndSendStatsFrame(void);
+#endif
 
 static u32 Unk_021C07C8 = 0;
 static CommunicationSystem *sCommunicationSystem = NULL;
@@ -138,6 +143,9 @@ static volatile u8 Unk_021C07C5 = 0;
 static volatile u8 Unk_02100A1C = 4;
 static volatile u8 Unk_02100A1D = 4;
 static u8 Unk_021C07C4 = 0;
+#ifdef COMM_SEND_STATS
+static CommSendStats sCommSendStats;
+#endif
 
 static BOOL CommSys_Init(BOOL shouldAlloc, int maxPacketSize)
 {
@@ -507,6 +515,9 @@ BOOL CommSys_Update(void)
     if (sCommunicationSystem != NULL) {
         if (!sCommunicationSystem->shuttingDown) {
             sCommunicationSystem->unk_6B5++;
+#ifdef COMM_SEND_STATS
+            CommSys_EndSendStatsFrame();
+#endif
             Unk_021C07C5 = 0;
             CommSys_UpdateTransitionType();
             sCommunicationSystem->sendHeldKeys |= (gSystem.heldKeys & 0x7fff);
@@ -625,6 +636,8 @@ static void sub_02034B50(void)
                 }
 
                 Unk_02100A1D = 4;
+            } else {
+                CommSys_RecordSendRetry();
             }
         }
     } else if (CommLocal_IsWifiGroup(sub_0203895C())) {
@@ -655,6 +668,8 @@ static void sub_02034B50(void)
             if (ov4_021D142C(sCommunicationSystem->sendBuffer[0], 38)) {
                 Unk_02100A1D = 4;
                 sCommunicationSystem->unk_660++;
+            } else {
+                CommSys_RecordSendRetry();
             }
         }
     } else if (((sub_02031934() == 4) && (CommSys_IsPlayerConnected(CommSys_CurNetId()))) || CommSys_IsAlone()) {
@@ -739,6 +754,7 @@ static void CommSys_UpdateServerClient(void)
             && !CommSys_IsAlone()
             && !sub_02031E9C(sCommunicationSystem->sendBufferServer[sCommunicationSystem->unk_6A8], 192, 14, sub_020353B0)) {
             Unk_02100A1C--;
+            CommSys_RecordSendRetry();
         }
 
         if ((Unk_02100A1C == 1) || (Unk_02100A1C == 3)) {
@@ -812,7 +828,7 @@ static void sub_02034F68(void)
                     }
                 }
             } else {
-                (void)0;
+                CommSys_RecordSendRetry();
             }
         }
     } else if ((sub_02031934() == 4) || (CommSys_IsAlone())) {
@@ -1056,6 +1072,7 @@ static void sub_020353CC(void)
 
                 if (!sub_02031E9C(sCommunicationSystem->sendBuffer[sCommunicationSystem->unk_6A7], v3, 14, sub_02035394)) {
                     Unk_02100A1D--;
+                    CommSys_RecordSendRetry();
                 } else {
                     sCommunicationSystem->unk_6A7 = 1 - sCommunicationSystem->unk_6A7;
                     sCommunicationSystem->unk_660++;
@@ -1299,13 +1316,70 @@ static BOOL sub_0203594C(void)
     return FALSE;
 }
 
+static BOOL CommSys_QueueCommand(CommQueueMan *queue, int cmd, u8 *data, int size, BOOL param4, BOOL copyToRing)
+{
+    BOOL queued = CommQueue_Write(queue, cmd, data, size, param4, copyToRing);
+
+#ifdef COMM_SEND_STATS
+    if (queued) {
+        int cmdSize = CommCmd_PacketSizeOf(cmd);
+
+        sCommSendStats.queuedCommands++;
+        sCommSendStats.curFrameBytes += cmdSize == 0xffff ? size : cmdSize;
+    } else {
+        sCommSendStats.droppedSends++;
+    }
+#endif
+
+    return queued;
+}
+
+static void CommSys_RecordSendRetry(void)
+{
+#ifdef COMM_SEND_STATS
+    sCommSendStats.retriedSends++;
+#endif
+}
+
+#ifdef COMM_SEND_STATS
+static void CommSys_EndSendStatsFrame(void)
+{
+    CommSendStats *stats = &sCommSendStats;
+
+    stats->frames++;
+    stats->lastFrameBytes = stats->curFrameBytes;
+    stats->curFrameBytes = 0;
+
+    if (stats->lastFrameBytes > stats->peakFrameBytes) {
+        stats->peakFrameBytes = stats->lastFrameBytes;
+    }
+
+    stats->queueDepth = CommQueue_NumPending(&sCommunicationSystem->commQueueManSend)
+        + CommQueue_NumPending(&sCommunicationSystem->commQueueManSendServer);
+
+    if (stats->queueDepth > stats->peakQueueDepth) {
+        stats->peakQueueDepth = stats->queueDepth;
+    }
+}
+
+void CommSys_GetSendStats(CommSendStats *stats)
+{
+    *stats = sCommSendStats;
+}
+
+void CommSys_ResetSendStats(void)
+{
+    MI_CpuClear8(&sCommSendStats, sizeof(CommSendStats));
+}
+#endif
+
 BOOL CommSys_SendDataHuge(int cmd, const void *data, int param2)
 {
     if (!CommSys_IsPlayerConnected(CommSys_CurNetId()) && !CommSys_IsAlone()) {
         return FALSE;
     }
 
-    if (CommQueue_Write(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 1, 0)) {
+    if (CommSys_QueueCommand(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 1, 0)) {
         return TRUE;
     }
 
@@ -1322,7 +1396,7 @@ BOOL CommSys_SendData(int cmd, const void *data, int param2)
         return FALSE;
     }
 
-    if (CommQueue_Write(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 1, 1)) {
+    if (CommSys_QueueCommand(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 1, 1)) {
         return TRUE;
     }
 
@@ -1348,7 +1422,7 @@ BOOL sub_02035A3C(int cmd, const void *data, int param2)
         return CommSys_SendDataHuge(cmd, data, param2);
     }
 
-    if (CommQueue_Write(&sCommunicationSystem->commQueueManSendServer, cmd, (u8 *)data, param2, 1, 0)) {
+    if (CommSys_QueueCommand(&sCommunicationSystem->commQueueManSendServer, cmd, (u8 *)data, param2, 1, 0)) {
         return TRUE;
     }
 
@@ -1375,7 +1449,7 @@ BOOL CommSys_SendDataServer(int cmd, const void *data, int param2)
         return CommSys_SendData(cmd, data, param2);
     }
 
-    if (CommQueue_Write(&sCommunicationSystem->commQueueManSendServer, cmd, (u8 *)data, param2, 1, 1)) {
+    if (CommSys_QueueCommand(&sCommunicationSystem->commQueueManSendServer, cmd, (u8 *)data, param2, 1, 1)) {
         return TRUE;
     }
 
@@ -1644,15 +1718,15 @@ BOOL CommSys_IsSendingMovementData(void)
 BOOL CommSys_WriteToQueueServer(int cmd, const void *data, int param2)
 {
     if (CommSys_TransmissionType() == 1) {
-        return CommQueue_Write(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 1, 0);
+        return CommSys_QueueCommand(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 1, 0);
     } else {
-        return CommQueue_Write(&sCommunicationSystem->commQueueManSendServer, cmd, (u8 *)data, param2, 1, 0);
+        return CommSys_QueueCommand(&sCommunicationSystem->commQueueManSendServer, cmd, (u8 *)data, param2, 1, 0);
     }
 }
 
 BOOL CommSys_WriteToQueue(int cmd, const void *data, int param2)
 {
-    return CommQueue_Write(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 0, 0);
+    return CommSys_QueueCommand(&sCommunicationSystem->commQueueManSend, cmd, (u8 *)data, param2, 0, 0);
 }
 
 static void CommSys_Transmission(void)
@@ -168,6 +168,18 @@ enum RenderResult Font_RenderText(enum Font font, TextPrinter *printer)
     return RenderText(printer);
 }
 
+enum RenderResult Font_RenderTextInstant(enum Font font, TextPrinter *printer, u32 *steps, u32 maxSteps)
+{
+    TextPrinterSubstruct *substruct = (TextPrinterSubstruct *)printer->substruct;
+
+    if (!substruct->fontIDSet) {
+        substruct->fontID = font;
+        substruct->fontIDSet = TRUE;
+    }
+
+    return RenderTextInstant(printer, steps, maxSteps);
+}
+
 u32 Font_CalcStringWidth(enum Font font, const charcode_t *str, u32 letterSpacing)
 {
     GF_ASSERT(sFontWork->fontManagers[font] != NULL);
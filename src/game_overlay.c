@@ -21,15 +21,35 @@ typedef struct {
     PMiLoadedOverlay unk_80[8];
 } UnkStruct_021BF370;
 
+typedef struct OverlayPrefetch {
+    FSFile file;
+    FSOverlayInfo info;
+    FSOverlayID id;
+    BOOL active;
+    OSTick startTick;
+} OverlayPrefetch;
+
+typedef struct OverlayLoadRecords {
+    OverlayLoadRecord records[OVERLAY_LOAD_RECORD_COUNT];
+    u32 next;
+    u32 count;
+} OverlayLoadRecords;
+
 static void FreeOverlayAllocation(PMiLoadedOverlay *loadedOverlays);
 static BOOL CanOverlayBeLoaded(const FSOverlayID overlayID);
+static BOOL DoesOverlayOverlapLoaded(const FSOverlayID overlayID);
+static BOOL DoOverlaysOverlap(const FSOverlayID overlayID1, const FSOverlayID overlayID2);
 static PMiLoadedOverlay *GetLoadedOverlaysInRegion(int param0);
 static BOOL GetOverlayRamBounds(const FSOverlayID overlayID, u32 *param1, u32 *param2);
 static BOOL LoadOverlayNormal(MIProcessor param0, FSOverlayID param1);
 static BOOL LoadOverlayNoInit(MIProcessor param0, FSOverlayID param1);
 static BOOL LoadOverlayNoInitAsync(MIProcessor param0, FSOverlayID param1);
+static BOOL LoadOverlayPrefetched(void);
+static void RecordOverlayLoad(FSOverlayID overlayID, OSTick startTick, BOOL prefetched);
 
 static UnkStruct_021BF370 Unk_021BF370;
+static OverlayPrefetch sOverlayPrefetch;
+static OverlayLoadRecords sOverlayLoadRecords;
 
 #ifdef GDB_DEBUGGING
 
@@ -115,11 +135,18 @@ int Overlay_GetLoadDestination(const FSOverlayID overlayID)
 
 BOOL Overlay_LoadByID(const FSOverlayID overlayID, enum OverlayLoadType loadType)
 {
-    BOOL result;
+    BOOL result, prefetched;
     u32 dmaBak = FS_DMA_NOT_USE;
     int overlayRegion;
     PMiLoadedOverlay *loadedOverlays;
     int i;
+    OSTick startTick = OS_GetTick();
+
+    prefetched = sOverlayPrefetch.active && sOverlayPrefetch.id == overlayID;
+
+    if (!prefetched && sOverlayPrefetch.active && DoOverlaysOverlap(overlayID, sOverlayPrefetch.id)) {
+        Overlay_CancelPrefetch();
+    }
 
     if (!CanOverlayBeLoaded(overlayID)) {
         return FALSE;
@@ -146,19 +173,23 @@ BOOL Overlay_LoadByID(const FSOverlayID overlayID, enum OverlayLoadType loadType
         dmaBak = FS_SetDefaultDMA(FS_DMA_NOT_USE);
     }
 
-    switch (loadType) {
-    case OVERLAY_LOAD_NORMAL:
-        result = LoadOverlayNormal(MI_PROCESSOR_ARM9, overlayID);
-        break;
-    case OVERLAY_LOAD_NOINIT:
-        result = LoadOverlayNoInit(MI_PROCESSOR_ARM9, overlayID);
-        break;
-    case OVERLAY_LOAD_ASYNC:
-        result = LoadOverlayNoInitAsync(MI_PROCESSOR_ARM9, overlayID);
-        break;
-    default:
-        GF_ASSERT(0);
-        return 0;
+    if (prefetched) {
+        result = LoadOverlayPrefetched();
+    } else {
+        switch (loadType) {
+        case OVERLAY_LOAD_NORMAL:
+            result = LoadOverlayNormal(MI_PROCESSOR_ARM9, overlayID);
+            break;
+        case OVERLAY_LOAD_NOINIT:
+            result = LoadOverlayNoInit(MI_PROCESSOR_ARM9, overlayID);
+            break;
+        case OVERLAY_LOAD_ASYNC:
+            result = LoadOverlayNoInitAsync(MI_PROCESSOR_ARM9, overlayID);
+            break;
+        default:
+            GF_ASSERT(0);
+            return 0;
+        }
     }
 
     if (overlayRegion == OVERLAY_REGION_ITCM || overlayRegion == OVERLAY_REGION_DTCM) {
@@ -170,31 +201,129 @@ BOOL Overlay_LoadByID(const FSOverlayID overlayID, enum OverlayLoadType loadType
         return FALSE;
     }
 
+    RecordOverlayLoad(overlayID, startTick, prefetched);
+
     return TRUE;
 }
 
+BOOL Overlay_Prefetch(const FSOverlayID overlayID)
+{
+    if (sOverlayPrefetch.active) {
+        if (sOverlayPrefetch.id == overlayID) {
+            return TRUE;
+        }
+
+        Overlay_CancelPrefetch();
+    }
+
+    // Only main RAM overlays are streamed ahead of time; TCM loads must not use
+    // DMA, and the image is written straight into the overlay's own RAM, so it
+    // has to be free of every overlay that is still loaded.
+    if (Overlay_GetLoadDestination(overlayID) != OVERLAY_REGION_MAIN
+        || DoesOverlayOverlapLoaded(overlayID)) {
+        return FALSE;
+    }
+
+    if (!FS_LoadOverlayInfo(&sOverlayPrefetch.info, MI_PROCESSOR_ARM9, overlayID)) {
+        return FALSE;
+    }
+
+    FS_InitFile(&sOverlayPrefetch.file);
+
+    if (!FS_LoadOverlayImageAsync(&sOverlayPrefetch.info, &sOverlayPrefetch.file)) {
+        if (FS_IsFile(&sOverlayPrefetch.file)) {
+            FS_CloseFile(&sOverlayPrefetch.file);
+        }
+
+        return FALSE;
+    }
+
+    sOverlayPrefetch.id = overlayID;
+    sOverlayPrefetch.active = TRUE;
+    sOverlayPrefetch.startTick = OS_GetTick();
+
+    return TRUE;
+}
+
+void Overlay_CancelPrefetch(void)
+{
+    if (sOverlayPrefetch.active == FALSE) {
+        return;
+    }
+
+    FS_CancelFile(&sOverlayPrefetch.file);
+    FS_WaitAsync(&sOverlayPrefetch.file);
+    FS_CloseFile(&sOverlayPrefetch.file);
+
+    sOverlayPrefetch.active = FALSE;
+}
+
+const OverlayLoadRecord *Overlay_GetLoadRecord(u32 age)
+{
+    if (age >= sOverlayLoadRecords.count) {
+        return NULL;
+    }
+
+    return &sOverlayLoadRecords.records[(sOverlayLoadRecords.next + OVERLAY_LOAD_RECORD_COUNT - 1 - age) % OVERLAY_LOAD_RECORD_COUNT];
+}
+
+static void RecordOverlayLoad(FSOverlayID overlayID, OSTick startTick, BOOL prefetched)
+{
+    OverlayLoadRecord *record = &sOverlayLoadRecords.records[sOverlayLoadRecords.next];
+
+    record->overlayID = overlayID;
+    record->loadTicks = (u32)(OS_GetTick() - startTick);
+    record->prefetchTicks = prefetched ? (u32)(startTick - sOverlayPrefetch.startTick) : 0;
+    record->prefetched = prefetched;
+
+    sOverlayLoadRecords.next = (sOverlayLoadRecords.next + 1) % OVERLAY_LOAD_RECORD_COUNT;
+
+    if (sOverlayLoadRecords.count < OVERLAY_LOAD_RECORD_COUNT) {
+        sOverlayLoadRecords.count++;
+    }
+}
+
 static BOOL CanOverlayBeLoaded(const FSOverlayID overlayID)
 {
-    u32 myStart, myEnd, theirStart, theirEnd;
-    PMiLoadedOverlay *loadedOverlays;
-    int i;
+    u32 myStart, myEnd;
 
     if (!GetOverlayRamBounds(overlayID, &myStart, &myEnd)) {
         return FALSE;
     }
 
-    loadedOverlays = GetLoadedOverlaysInRegion(Overlay_GetLoadDestination(overlayID));
+    if (DoesOverlayOverlapLoaded(overlayID)) {
+        GF_ASSERT(0);
+        return FALSE;
+    }
+
+    return TRUE;
+}
+
+static BOOL DoesOverlayOverlapLoaded(const FSOverlayID overlayID)
+{
+    PMiLoadedOverlay *loadedOverlays = GetLoadedOverlaysInRegion(Overlay_GetLoadDestination(overlayID));
+    int i;
 
     for (i = 0; i < 8; i++) {
-        if (loadedOverlays[i].isActive == TRUE && GetOverlayRamBounds(loadedOverlays[i].id, &theirStart, &theirEnd) == TRUE) {
-            if (((myStart >= theirStart) && (myStart < theirEnd)) || ((myEnd > theirStart) && (myEnd <= theirEnd)) || ((myStart <= theirStart) && (myEnd >= theirEnd))) {
-                GF_ASSERT(0);
-                return FALSE;
-            }
+        if (loadedOverlays[i].isActive == TRUE && DoOverlaysOverlap(overlayID, loadedOverlays[i].id)) {
+            return TRUE;
         }
     }
 
-    return TRUE;
+    return FALSE;
+}
+
+static BOOL DoOverlaysOverlap(const FSOverlayID overlayID1, const FSOverlayID overlayID2)
+{
+    u32 myStart, myEnd, theirStart, theirEnd;
+
+    if (!GetOverlayRamBounds(overlayID1, &myStart, &myEnd) || !GetOverlayRamBounds(overlayID2, &theirStart, &theirEnd)) {
+        return FALSE;
+    }
+
+    return ((myStart >= theirStart) && (myStart < theirEnd))
+        || ((myEnd > theirStart) && (myEnd <= theirEnd))
+        || ((myStart <= theirStart) && (myEnd >= theirEnd));
 }
 
 static PMiLoadedOverlay *GetLoadedOverlaysInRegion(int region)
@@ -281,3 +410,26 @@ static BOOL LoadOverlayNoInitAsync(MIProcessor proc, FSOverlayID overlayID)
 
     return TRUE;
 }
+
+static BOOL LoadOverlayPrefetched(void)
+{
+    BOOL result;
+
+    FS_WaitAsync(&sOverlayPrefetch.file);
+    result = FS_GetResultCode(&sOverlayPrefetch.file) == FS_RESULT_SUCCESS;
+    FS_CloseFile(&sOverlayPrefetch.file);
+
+    sOverlayPrefetch.active = FALSE;
+
+    if (result == FALSE) {
+        // Fall back to a regular load if the streamed image did not make it
+        return LoadOverlayNormal(MI_PROCESSOR_ARM9, sOverlayPrefetch.id);
+    }
+
+#ifdef GDB_DEBUGGING
+    LoadOverlayGDB(sOverlayPrefetch.id);
+#endif
+
+    FS_StartOverlay(&sOverlayPrefetch.info);
+    return TRUE;
+}
@@ -3,7 +3,10 @@
 #include <nitro.h>
 #include <string.h>
 
+#include "constants/heap.h"
+
 #include "error_message_reset.h"
+#include "system.h"
 #include "unk_020366A0.h"
 
 typedef struct {
@@ -19,11 +22,59 @@ typedef struct {
 } HeapInfo;
 
 typedef struct {
+#ifdef HEAP_TRACING
+    void *caller;
+    u32 size;
+    char filler_08[4];
+#else
     char filler_00[12];
+#endif
     u32 heapID : 8;
     u32 filler_0D : 24;
 } MemoryBlock;
 
+#ifdef HEAP_TRACING
+#define HEAP_TRACE_MAX_SITES     128
+#define HEAP_TRACE_REPORT_FRAMES 600
+#define HEAP_TRACE_REPORT_SIZE   0x2000
+
+#ifdef __MWERKS__
+#define HEAP_TRACE_CALLER() __return_address()
+#else
+#define HEAP_TRACE_CALLER() __builtin_return_address(0)
+#endif
+
+typedef struct HeapTraceStats {
+    u32 liveBytes;
+    u32 peakBytes;
+    u32 allocs;
+    u32 frees;
+    u32 fails;
+} HeapTraceStats;
+
+typedef struct HeapTraceSite {
+    void *caller;
+    u32 heapID;
+    u32 allocs;
+    u32 bytes;
+} HeapTraceSite;
+
+typedef struct HeapTrace {
+    HeapTraceStats stats[HEAP_ID_MAX];
+    HeapTraceSite sites[HEAP_TRACE_MAX_SITES];
+    u32 droppedSites;
+    u32 startFrame;
+    u32 lastReportFrame;
+} HeapTrace;
+
+static void HeapTrace_Alloc(u32 heapID, void *ptr, u32 size, void *caller);
+static void HeapTrace_Free(MemoryBlock *block);
+static void HeapTrace_Resize(MemoryBlock *block, u32 newSize);
+
+static HeapTrace sHeapTrace;
+static char sHeapTraceReport[HEAP_TRACE_REPORT_SIZE];
+#endif // HEAP_TRACING
+
 static int FindFirstAvailableHeapHandle(void);
 static BOOL CreateHeapInternal(u32 parent, u32 child, u32 size, s32 alignment);
 static void *AllocFromHeapInternal(NNSFndHeapHandle heap, u32 size, s32 alignment, u32 heapID);
@@ -218,6 +269,10 @@ void *Heap_AllocFromHeap(u32 heapID, u32 size)
         ptr = AllocFromHeapInternal(heap, size, 4, heapID);
     }
 
+#ifdef HEAP_TRACING
+    HeapTrace_Alloc(heapID, ptr, size, HEAP_TRACE_CALLER());
+#endif
+
     if (ptr != NULL) {
         sHeapInfo.numMemBlocks[heapID]++;
     } else {
@@ -237,6 +292,10 @@ void *Heap_AllocFromHeapAtEnd(u32 heapID, u32 size)
         ptr = AllocFromHeapInternal(heap, size, -4, heapID);
     }
 
+#ifdef HEAP_TRACING
+    HeapTrace_Alloc(heapID, ptr, size, HEAP_TRACE_CALLER());
+#endif
+
     if (ptr != NULL) {
         sHeapInfo.numMemBlocks[heapID]++;
     } else {
@@ -265,6 +324,10 @@ void Heap_FreeToHeap(void *ptr)
 
         sHeapInfo.numMemBlocks[heapID]--;
 
+#ifdef HEAP_TRACING
+        HeapTrace_Free(ptr);
+#endif
+
         {
             OSIntrMode intrMode;
 
@@ -293,6 +356,10 @@ void Heap_FreeToHeapExplicit(u32 heapID, void *ptr)
             GF_ASSERT(0);
         }
 
+#ifdef HEAP_TRACING
+        HeapTrace_Free(ptr);
+#endif
+
         NNS_FndFreeToExpHeap(heap, ptr);
 
         GF_ASSERT(sHeapInfo.numMemBlocks[heapID]);
@@ -337,6 +404,10 @@ void Heap_ReallocFromHeap(void *ptr, u32 newSize)
         u8 index = sHeapInfo.heapIdxs[heapID];
         NNSFndHeapHandle heap = sHeapInfo.heapHandles[index];
 
+#ifdef HEAP_TRACING
+        HeapTrace_Resize(ptr, newSize - sizeof(MemoryBlock));
+#endif
+
         NNS_FndResizeForMBlockExpHeap(heap, ptr, newSize);
     } else {
         GF_ASSERT(0);
@@ -347,3 +418,167 @@ BOOL GF_heap_c_dummy_return_true(u32 heapID)
 {
     return TRUE;
 }
+
+#ifdef HEAP_TRACING
+static void HeapTrace_Alloc(u32 heapID, void *ptr, u32 size, void *caller)
+{
+    if (heapID >= HEAP_ID_MAX) {
+        return;
+    }
+
+    HeapTraceStats *stats = &sHeapTrace.stats[heapID];
+
+    if (ptr == NULL) {
+        stats->fails++;
+        return;
+    }
+
+    MemoryBlock *block = (MemoryBlock *)ptr - 1;
+    block->caller = caller;
+    block->size = size;
+
+    stats->allocs++;
+    stats->liveBytes += size;
+
+    if (stats->liveBytes > stats->peakBytes) {
+        stats->peakBytes = stats->liveBytes;
+    }
+
+    // Open addressing on the caller address; sites are never removed
+    u32 hash = (((u32)caller >> 1) * 0x9E3779B1) >> 25;
+
+    for (u32 i = 0; i < HEAP_TRACE_MAX_SITES; i++) {
+        HeapTraceSite *site = &sHeapTrace.sites[(hash + i) % HEAP_TRACE_MAX_SITES];
+
+        if (site->caller == NULL) {
+            site->caller = caller;
+            site->heapID = heapID;
+        } else if (site->caller != caller || site->heapID != heapID) {
+            continue;
+        }
+
+        site->allocs++;
+        site->bytes += size;
+        return;
+    }
+
+    sHeapTrace.droppedSites++;
+}
+
+static void HeapTrace_Free(MemoryBlock *block)
+{
+    if (block->heapID >= HEAP_ID_MAX) {
+        return;
+    }
+
+    HeapTraceStats *stats = &sHeapTrace.stats[block->heapID];
+
+    stats->frees++;
+    stats->liveBytes -= block->size;
+}
+
+static void HeapTrace_Resize(MemoryBlock *block, u32 newSize)
+{
+    if (block->heapID >= HEAP_ID_MAX) {
+        return;
+    }
+
+    HeapTraceStats *stats = &sHeapTrace.stats[block->heapID];
+
+    stats->liveBytes = stats->liveBytes - block->size + newSize;
+    block->size = newSize;
+
+    if (stats->liveBytes > stats->peakBytes) {
+        stats->peakBytes = stats->liveBytes;
+    }
+}
+
+u32 Heap_TraceDump(char *buf, u32 bufSize)
+{
+    u32 written = 0;
+    u32 frames = gSystem.vblankCounter - sHeapTrace.startFrame;
+
+    written += OS_SNPrintf(buf + written, bufSize - written, "HEAPTRACE frames=%lu dropped=%lu\n", frames, sHeapTrace.droppedSites);
+
+    for (u32 heapID = 0; heapID < HEAP_ID_MAX && heapID < sHeapInfo.totalNumHeaps && written < bufSize; heapID++) {
+        HeapTraceStats *stats = &sHeapTrace.stats[heapID];
+        NNSFndHeapHandle heap = sHeapInfo.heapHandles[sHeapInfo.heapIdxs[heapID]];
+
+        if (heap == NNS_FND_HEAP_INVALID_HANDLE && stats->allocs == 0) {
+            continue;
+        }
+
+        written += OS_SNPrintf(buf + written,
+            bufSize - written,
+            "HEAP id=%lu live=%lu peak=%lu allocs=%lu frees=%lu fails=%lu free=%lu largest=%lu\n",
+            heapID,
+            stats->liveBytes,
+            stats->peakBytes,
+            stats->allocs,
+            stats->frees,
+            stats->fails,
+            heap != NNS_FND_HEAP_INVALID_HANDLE ? NNS_FndGetTotalFreeSizeForExpHeap(heap) : 0,
+            heap != NNS_FND_HEAP_INVALID_HANDLE ? NNS_FndGetAllocatableSizeForExpHeap(heap) : 0);
+    }
+
+    for (u32 i = 0; i < HEAP_TRACE_MAX_SITES && written < bufSize; i++) {
+        HeapTraceSite *site = &sHeapTrace.sites[i];
+
+        if (site->caller == NULL) {
+            continue;
+        }
+
+        written += OS_SNPrintf(buf + written,
+            bufSize - written,
+            "SITE heap=%lu caller=%08X allocs=%lu bytes=%lu\n",
+            site->heapID,
+            site->caller,
+            site->allocs,
+            site->bytes);
+    }
+
+    return written < bufSize ? written : bufSize;
+}
+
+void Heap_TraceUpdate(void)
+{
+    if (gSystem.vblankCounter - sHeapTrace.lastReportFrame < HEAP_TRACE_REPORT_FRAMES) {
+        return;
+    }
+
+    sHeapTrace.lastReportFrame = gSystem.vblankCounter;
+    Heap_TraceDump(sHeapTraceReport, sizeof(sHeapTraceReport));
+
+    // OS_Printf truncates long strings, so the dump goes out a line at a time
+    char *line = sHeapTraceReport;
+    char *end;
+
+    while ((end = strchr(line, '\n')) != NULL) {
+        *end = '\0';
+        OS_Printf("%s\n", line);
+        line = end + 1;
+    }
+
+    // A dump cut short by the buffer size ends without a newline
+    if (*line != '\0') {
+        OS_Printf("%s\n", line);
+    }
+}
+
+void Heap_TraceReset(void)
+{
+    // Live bytes describe blocks that are still allocated, so they survive a reset
+    for (u32 heapID = 0; heapID < HEAP_ID_MAX; heapID++) {
+        HeapTraceStats *stats = &sHeapTrace.stats[heapID];
+
+        stats->peakBytes = stats->liveBytes;
+        stats->allocs = 0;
+        stats->frees = 0;
+        stats->fails = 0;
+    }
+
+    memset(sHeapTrace.sites, 0, sizeof(sHeapTrace.sites));
+    sHeapTrace.droppedSites = 0;
+    sHeapTrace.startFrame = gSystem.vblankCounter;
+}
+#endif // HEAP_TRACING
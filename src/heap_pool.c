@@ -0,0 +1,109 @@
+#include "heap_pool.h"
+
+#include <nitro.h>
+#include <string.h>
+
+#include "heap.h"
+
+// Debug builds fill free slots with a pattern and check it on allocation,
+// which catches writes through stale pointers.
+#ifdef HEAP_TRACING
+#define HEAP_POOL_POISON
+#endif
+
+#define HEAP_POOL_FREE_BYTE  0xDD
+#define HEAP_POOL_ALLOC_BYTE 0xCD
+
+#ifdef HEAP_POOL_POISON
+static void HeapPool_PoisonSlot(HeapPool *pool, void *slot);
+static void HeapPool_CheckSlot(HeapPool *pool, void *slot);
+#endif
+
+HeapPool *HeapPool_New(u32 heapID, u32 slotSize, u32 numSlots)
+{
+    GF_ASSERT(numSlots > 0);
+
+    // Each free slot holds the link to the next one
+    if (slotSize < sizeof(void *)) {
+        slotSize = sizeof(void *);
+    }
+
+    slotSize = (slotSize + 3) & ~3;
+
+    HeapPool *pool = Heap_AllocFromHeap(heapID, sizeof(HeapPool) + slotSize * numSlots);
+
+    if (pool == NULL) {
+        return NULL;
+    }
+
+    pool->heapID = heapID;
+    pool->slotSize = slotSize;
+    pool->numSlots = numSlots;
+    pool->slots = (u8 *)pool + sizeof(HeapPool);
+    pool->slotsEnd = pool->slots + slotSize * numSlots;
+    pool->freeList = NULL;
+
+    // Thread the free list so that slots are handed out in address order
+    for (u32 i = numSlots; i > 0; i--) {
+        void *slot = pool->slots + slotSize * (i - 1);
+
+#ifdef HEAP_POOL_POISON
+        HeapPool_PoisonSlot(pool, slot);
+#endif
+        *(void **)slot = pool->freeList;
+        pool->freeList = slot;
+    }
+
+    return pool;
+}
+
+void *HeapPool_Alloc(HeapPool *pool)
+{
+    void *slot = pool->freeList;
+
+    if (slot == NULL) {
+        return NULL;
+    }
+
+    pool->freeList = *(void **)slot;
+
+#ifdef HEAP_POOL_POISON
+    HeapPool_CheckSlot(pool, slot);
+    memset(slot, HEAP_POOL_ALLOC_BYTE, pool->slotSize);
+#endif
+
+    return slot;
+}
+
+void HeapPool_Free(HeapPool *pool, void *ptr)
+{
+    GF_ASSERT(HeapPool_Contains(pool, ptr));
+    GF_ASSERT(((u8 *)ptr - pool->slots) % pool->slotSize == 0);
+
+#ifdef HEAP_POOL_POISON
+    HeapPool_PoisonSlot(pool, ptr);
+#endif
+
+    *(void **)ptr = pool->freeList;
+    pool->freeList = ptr;
+}
+
+BOOL HeapPool_Contains(const HeapPool *pool, const void *ptr)
+{
+    return (const u8 *)ptr >= pool->slots && (const u8 *)ptr < pool->slotsEnd;
+}
+
+#ifdef HEAP_POOL_POISON
+static void HeapPool_PoisonSlot(HeapPool *pool, void *slot)
+{
+    memset(slot, HEAP_POOL_FREE_BYTE, pool->slotSize);
+}
+
+static void HeapPool_CheckSlot(HeapPool *pool, void *slot)
+{
+    // The first word holds the free list link
+    for (u32 i = sizeof(void *); i < pool->slotSize; i++) {
+        GF_ASSERT(((u8 *)slot)[i] == HEAP_POOL_FREE_BYTE);
+    }
+}
+#endif // HEAP_POOL_POISON
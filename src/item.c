@@ -5,7 +5,9 @@
 
 #include "constants/items.h"
 #include "constants/moves.h"
+#include "generated/text_banks.h"
 
+#include "assert.h"
 #include "bag.h"
 #include "heap.h"
 #include "message.h"
@@ -19,8 +21,14 @@ typedef struct {
     u16 gen3ID;
 } ItemArchiveIDs;
 
+// Upper bound on the resident parameter table. One ItemData record is kept for
+// every data ID, so this must grow with the item data archive.
+#define ITEM_RESIDENT_TABLE_BUDGET 0x4800
+
 static s32 ItemPartyParam_Get(ItemPartyParam *partyParam, enum ItemDataParam attributeID);
 
+static ItemData *sResidentItemTable;
+
 const ItemArchiveIDs sItemArchiveIDs[] = {
     { 0x0, 0x2C3, 0x2C4, 0x0 },
     { 0x1, 0x2, 0x3, 0x1 },
@@ -786,22 +794,24 @@ void *Item_Load(u16 item, enum ItemFileType type, u32 heapID)
 
 void Item_LoadName(Strbuf *dst, u16 item, u32 heapID)
 {
-    MessageLoader *msgData = MessageLoader_Init(1, 26, 392, heapID);
-
-    MessageLoader_GetStrbuf(msgData, item, dst);
-    MessageLoader_Free(msgData);
+    MessageCache_GetStrbuf(TEXT_BANK_ITEM_NAMES, item, heapID, dst);
 }
 
 void Item_LoadDescription(Strbuf *dst, u16 item, u16 heapID)
 {
-    MessageLoader *msgData = MessageLoader_Init(1, 26, 391, heapID);
-
-    MessageLoader_GetStrbuf(msgData, item, dst);
-    MessageLoader_Free(msgData);
+    MessageCache_GetStrbuf(TEXT_BANK_UNK_0391, item, heapID, dst);
 }
 
 s32 Item_LoadParam(u16 item, enum ItemDataParam param, u32 heapID)
 {
+    if (sResidentItemTable != NULL) {
+        if (item > NUM_ITEMS) {
+            item = ITEM_NONE;
+        }
+
+        return Item_Get(&sResidentItemTable[sItemArchiveIDs[item].dataID], param);
+    }
+
     ItemData *itemData = (ItemData *)Item_Load(item, 0, heapID);
     s32 val = Item_Get(itemData, param);
     Heap_FreeToHeapExplicit(heapID, itemData);
@@ -1058,3 +1068,13 @@ ItemData *ItemTable_Index(ItemData *itemTable, u16 index)
 {
     return (ItemData *)((u8 *)itemTable + index * sizeof(ItemData));
 }
+
+void ItemTable_LoadResident(u32 heapID)
+{
+    GF_ASSERT(sResidentItemTable == NULL);
+
+    u32 size = sizeof(ItemData) * (Item_FileID(NUM_ITEMS, ITEM_FILE_TYPE_DATA) + 1);
+    GF_ASSERT(size <= ITEM_RESIDENT_TABLE_BUDGET);
+
+    sResidentItemTable = NARC_AllocAndReadFromMemberByIndexPair(NARC_INDEX_ITEMTOOL__ITEMDATA__PL_ITEM_DATA, 0, heapID, 0, size);
+}
@@ -16,9 +16,13 @@
 #include "font.h"
 #include "game_overlay.h"
 #include "game_start.h"
+#include "heap.h"
+#include "item.h"
 #include "main.h"
 #include "math.h"
+#include "message.h"
 #include "overlay_manager.h"
+#include "pokemon.h"
 #include "rtc.h"
 #include "save_player.h"
 #include "savedata.h"
@@ -81,6 +85,10 @@ void NitroMain(void)
     Font_InitManager(FONT_SYSTEM, HEAP_ID_APPLICATION);
     Font_InitManager(FONT_MESSAGE, HEAP_ID_APPLICATION);
     Font_InitManager(FONT_UNOWN, HEAP_ID_APPLICATION);
+    ItemTable_LoadResident(HEAP_ID_APPLICATION);
+    Pokemon_LoadDexNumberTables(HEAP_ID_APPLICATION);
+    MessageCache_Init(HEAP_ID_APPLICATION);
+    MessageLoader_InitPool(HEAP_ID_APPLICATION);
 
     sApplication.args.unk_00 = -1;
     sApplication.args.saveData = SaveData_Init();
@@ -148,6 +156,10 @@ void NitroMain(void)
         sub_020241CC();
         SysTaskManager_ExecuteTasks(gSystem.printTaskMgr);
 
+#ifdef HEAP_TRACING
+        Heap_TraceUpdate();
+#endif
+
         OS_WaitIrq(TRUE, OS_IE_V_BLANK);
 
         gSystem.vblankCounter++;
@@ -197,6 +209,13 @@ static void RunApplication(void)
         if (sApplication.currOverlayID != FS_OVERLAY_ID_NONE) {
             Overlay_UnloadByID(sApplication.currOverlayID);
         }
+
+        // The finished application queues its successor on exit, and its
+        // region has just been freed, so the next image can stream in while
+        // this frame finishes instead of blocking the next one
+        if (sApplication.nextOverlayID != FS_OVERLAY_ID_NONE) {
+            Overlay_Prefetch(sApplication.nextOverlayID);
+        }
     }
 }
 
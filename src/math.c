@@ -236,16 +236,70 @@ static u16 LCRNG_NextFrom(u32 *seed)
     return *seed >> 16;
 }
 
-static MATHCRC16Table *sCRC16Table = NULL;
-
+#define CRC16_CCITT_INIT  0xffff
+#define CRC16_SLICE_COUNT 4
+#define CRC16_TABLE_SIZE  256
+
+// The base table is the SDK's CRC16-CCITT table. Each further slice advances a
+// byte's contribution past one more trailing byte, so four bytes can be folded
+// into the CRC with one lookup each.
+typedef struct CRC16SliceTables {
+    MATHCRC16Table base;
+    u16 slices[CRC16_SLICE_COUNT - 1][CRC16_TABLE_SIZE];
+} CRC16SliceTables;
+
+static CRC16SliceTables *sCRC16Tables = NULL;
+
+// Bit-identical to MATH_CalcCRC16CCITT, but processes aligned data a word at a
+// time using slice-by-4 tables.
 u16 CalcCRC16Checksum(const void *data, u32 dataLen)
 {
-    return MATH_CalcCRC16CCITT(sCRC16Table, data, dataLen);
+    const u16 *table0 = sCRC16Tables->base.table;
+    const u16 *table1 = sCRC16Tables->slices[0];
+    const u16 *table2 = sCRC16Tables->slices[1];
+    const u16 *table3 = sCRC16Tables->slices[2];
+    const u8 *bytes = data;
+    u32 crc = CRC16_CCITT_INIT;
+
+    while (dataLen != 0 && ((u32)bytes & 3) != 0) {
+        crc = ((crc << 8) ^ table0[(crc >> 8) ^ *bytes++]) & 0xffff;
+        dataLen--;
+    }
+
+    const u32 *words = (const u32 *)bytes;
+
+    for (; dataLen >= 4; dataLen -= 4) {
+        u32 word = *words++;
+
+        crc = table3[((crc >> 8) ^ word) & 0xff]
+            ^ table2[(crc ^ (word >> 8)) & 0xff]
+            ^ table1[(word >> 16) & 0xff]
+            ^ table0[word >> 24];
+    }
+
+    bytes = (const u8 *)words;
+
+    while (dataLen != 0) {
+        crc = ((crc << 8) ^ table0[(crc >> 8) ^ *bytes++]) & 0xffff;
+        dataLen--;
+    }
+
+    return crc;
 }
 
 void InitCRC16Table(enum HeapId heapID)
 {
-    GF_ASSERT(sCRC16Table == NULL);
-    sCRC16Table = Heap_AllocFromHeap(heapID, sizeof(MATHCRC16Table));
-    MATH_CRC16CCITTInitTable(sCRC16Table);
+    GF_ASSERT(sCRC16Tables == NULL);
+    sCRC16Tables = Heap_AllocFromHeap(heapID, sizeof(CRC16SliceTables));
+    MATH_CRC16CCITTInitTable(&sCRC16Tables->base);
+
+    const u16 *prev = sCRC16Tables->base.table;
+
+    for (int i = 0; i < CRC16_SLICE_COUNT - 1; i++) {
+        for (int j = 0; j < CRC16_TABLE_SIZE; j++) {
+            sCRC16Tables->slices[i][j] = (prev[j] << 8) ^ sCRC16Tables->base.table[prev[j] >> 8];
+        }
+
+        prev = sCRC16Tables->slices[i];
+    }
 }
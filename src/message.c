@@ -6,13 +6,48 @@
 #include "generated/text_banks.h"
 
 #include "heap.h"
+#include "heap_pool.h"
 #include "narc.h"
 #include "strbuf.h"
 
 #define KEY_START 596947
 #define KEY_INC   18749
 
+#define MESSAGE_CACHE_MAX_BANKS   8
+#define MESSAGE_CACHE_MAX_STRINGS 24
+#define MESSAGE_CACHE_MAX_LENGTH  24
+
+#define MESSAGE_LOADER_POOL_SIZE 16
+
+typedef struct MessageCacheBank {
+    u16 bankID;
+    u16 count;
+    u16 seed;
+} MessageCacheBank;
+
+typedef struct MessageCacheString {
+    u16 bankID;
+    u16 entryID;
+    u16 length;
+    charcode_t chars[MESSAGE_CACHE_MAX_LENGTH];
+} MessageCacheString;
+
+typedef struct MessageCache {
+    NARC *narc;
+    u8 numBanks;
+    u8 nextBank;
+    u8 numStrings;
+    u8 nextString;
+    MessageCacheBank banks[MESSAGE_CACHE_MAX_BANKS];
+    MessageCacheString strings[MESSAGE_CACHE_MAX_STRINGS];
+} MessageCache;
+
+static MessageCache *sMessageCache = NULL;
+static HeapPool *sMessageLoaderPool = NULL;
+
 static void MemCopyEntry(charcode_t *dst, const charcode_t *src, const MessageBankEntry *entry);
+static MessageLoader *MessageLoader_Alloc(u32 heapID);
+static void MessageLoader_Release(MessageLoader *loader);
 
 static inline int EntryOffset(u32 bankIndex)
 {
@@ -246,16 +281,48 @@ u32 MessageBank_NARCEntryCount(u32 narcID, u32 bankID)
     return bank.count;
 }
 
+void MessageLoader_InitPool(u32 heapID)
+{
+    GF_ASSERT(sMessageLoaderPool == NULL);
+    sMessageLoaderPool = HeapPool_New(heapID, sizeof(MessageLoader), MESSAGE_LOADER_POOL_SIZE);
+}
+
+// Loaders are short-lived and all the same size, so they come from a small
+// shared pool first and only fall back to the caller's heap when it runs dry.
+static MessageLoader *MessageLoader_Alloc(u32 heapID)
+{
+    MessageLoader *loader = NULL;
+
+    if (sMessageLoaderPool != NULL) {
+        loader = HeapPool_Alloc(sMessageLoaderPool);
+    }
+
+    if (loader == NULL) {
+        loader = Heap_AllocFromHeapAtEnd(heapID, sizeof(MessageLoader));
+    }
+
+    return loader;
+}
+
+static void MessageLoader_Release(MessageLoader *loader)
+{
+    if (sMessageLoaderPool != NULL && HeapPool_Contains(sMessageLoaderPool, loader)) {
+        HeapPool_Free(sMessageLoaderPool, loader);
+    } else {
+        Heap_FreeToHeap(loader);
+    }
+}
+
 MessageLoader *MessageLoader_Init(enum MessageLoaderType type, u32 narcID, u32 bankID, u32 heapID)
 {
-    MessageLoader *loader = Heap_AllocFromHeapAtEnd(heapID, sizeof(MessageLoader));
+    MessageLoader *loader = MessageLoader_Alloc(heapID);
 
     if (loader) {
         if (type == MESSAGE_LOADER_BANK_HANDLE) {
             loader->bank = MessageBank_Load(narcID, bankID, heapID);
 
             if (loader->bank == NULL) {
-                Heap_FreeToHeap(loader);
+                MessageLoader_Release(loader);
                 return NULL;
             }
         } else {
@@ -283,7 +350,7 @@ void MessageLoader_Free(MessageLoader *loader)
             break;
         }
 
-        Heap_FreeToHeap(loader);
+        MessageLoader_Release(loader);
     }
 }
 
@@ -342,3 +409,109 @@ void MessageLoader_GetSpeciesName(u32 species, u32 heapID, charcode_t *dst)
     MessageLoader_Get(loader, species, dst);
     MessageLoader_Free(loader);
 }
+
+void MessageCache_Init(u32 heapID)
+{
+    GF_ASSERT(sMessageCache == NULL);
+
+    sMessageCache = Heap_AllocFromHeap(heapID, sizeof(MessageCache));
+    GF_ASSERT(sMessageCache);
+
+    sMessageCache->narc = NARC_ctor(NARC_INDEX_MSGDATA__PL_MSG, heapID);
+    sMessageCache->numBanks = 0;
+    sMessageCache->nextBank = 0;
+    sMessageCache->numStrings = 0;
+    sMessageCache->nextString = 0;
+}
+
+static const MessageCacheBank *MessageCache_GetBank(MessageCache *cache, u32 bankID)
+{
+    int i;
+
+    for (i = 0; i < cache->numBanks; i++) {
+        if (cache->banks[i].bankID == bankID) {
+            return &cache->banks[i];
+        }
+    }
+
+    MessageBank header;
+    NARC_ReadFromMember(cache->narc, bankID, 0, sizeof(MessageBank), &header);
+
+    MessageCacheBank *bank = &cache->banks[cache->nextBank];
+    bank->bankID = bankID;
+    bank->count = header.count;
+    bank->seed = header.seed;
+
+    cache->nextBank = (cache->nextBank + 1) % MESSAGE_CACHE_MAX_BANKS;
+
+    if (cache->numBanks < MESSAGE_CACHE_MAX_BANKS) {
+        cache->numBanks++;
+    }
+
+    return bank;
+}
+
+void MessageCache_GetStrbuf(u32 bankID, u32 entryID, u32 heapID, Strbuf *strbuf)
+{
+    MessageCache *cache = sMessageCache;
+    int i;
+
+    if (cache == NULL) {
+        MessageBank_GetStrbufFromNARC(NARC_INDEX_MSGDATA__PL_MSG, bankID, entryID, heapID, strbuf);
+        return;
+    }
+
+    for (i = 0; i < cache->numStrings; i++) {
+        const MessageCacheString *string = &cache->strings[i];
+
+        if (string->bankID == bankID && string->entryID == entryID) {
+            Strbuf_CopyNumChars(strbuf, string->chars, string->length);
+            return;
+        }
+    }
+
+    const MessageCacheBank *bank = MessageCache_GetBank(cache, bankID);
+
+    if (entryID >= bank->count) {
+        GF_ASSERT(FALSE);
+        Strbuf_Clear(strbuf);
+        return;
+    }
+
+    MessageBankEntry entry;
+    NARC_ReadFromMember(cache->narc, bankID, EntryOffset(entryID), sizeof(MessageBankEntry), &entry);
+    DecodeEntry(&entry, entryID, bank->seed);
+
+    u32 size = entry.length * sizeof(charcode_t);
+
+    // Strings too long to cache are decoded into a temporary buffer instead.
+    if (entry.length > MESSAGE_CACHE_MAX_LENGTH) {
+        charcode_t *cstr = Heap_AllocFromHeapAtEnd(heapID, size);
+
+        if (cstr) {
+            NARC_ReadFromMember(cache->narc, bankID, entry.offset, size, cstr);
+            DecodeString(cstr, entry.length, entryID, bank->seed);
+            Strbuf_CopyNumChars(strbuf, cstr, entry.length);
+            Heap_FreeToHeap(cstr);
+        }
+
+        return;
+    }
+
+    MessageCacheString *string = &cache->strings[cache->nextString];
+
+    NARC_ReadFromMember(cache->narc, bankID, entry.offset, size, string->chars);
+    DecodeString(string->chars, entry.length, entryID, bank->seed);
+
+    string->bankID = bankID;
+    string->entryID = entryID;
+    string->length = entry.length;
+
+    cache->nextString = (cache->nextString + 1) % MESSAGE_CACHE_MAX_STRINGS;
+
+    if (cache->numStrings < MESSAGE_CACHE_MAX_STRINGS) {
+        cache->numStrings++;
+    }
+
+    Strbuf_CopyNumChars(strbuf, string->chars, string->length);
+}
@@ -9,15 +9,33 @@
 
 static void LoadMoveEntry(int move, MoveTable *entry);
 
+static const MoveTable *sResidentMoveTable;
+
 void MoveTable_Load(void *buf)
 {
     NARC_ReadFromMemberByIndexPair(buf, NARC_INDEX_POKETOOL__WAZA__PL_WAZA_TBL, 0, 0, sizeof(MoveTable) * MAX_MOVES);
 }
 
+void MoveTable_SetResident(const MoveTable *table)
+{
+    sResidentMoveTable = table;
+}
+
+void MoveTable_ClearResident(const MoveTable *table)
+{
+    if (sResidentMoveTable == table) {
+        sResidentMoveTable = NULL;
+    }
+}
+
 u32 MoveTable_LoadParam(int move, enum MoveAttribute param)
 {
     MoveTable moveData;
 
+    if (sResidentMoveTable != NULL && move >= 0 && move < MAX_MOVES) {
+        return MoveTable_Get((MoveTable *)&sResidentMoveTable[move], param);
+    }
+
     LoadMoveEntry(move, &moveData);
     return MoveTable_Get(&moveData, param);
 }
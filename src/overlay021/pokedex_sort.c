@@ -23,6 +23,8 @@
 #define NUMSTATFILES 11
 #define BLANKSPACE   (NATIONAL_DEX_COUNT + 1)
 
+#define SPECIES_BITSET_SIZE_U32 ((BLANKSPACE >> 5) + 1)
+
 enum PokedexDataSortIndex {
     PDSI_NATIONAL,
     PDSI_SINNOH,
@@ -644,25 +646,33 @@ static void FilterUnencountered(u16 *encounteredDex, int *caughtStatusLength, co
 
 static void IntersectPokedexes(u16 *resultingPokedex, int *numResulting, const u16 *pokedex1, int dexLen1, const u16 *pokedex2, int dexLen2, BOOL keepUncaught, const Pokedex *pokedex)
 {
-    int dexIndex2;
+    int dexIndex;
+    u16 species;
+    u32 inPokedex2[SPECIES_BITSET_SIZE_U32];
+
+    memset(inPokedex2, 0, sizeof(inPokedex2));
+
+    for (dexIndex = 0; dexIndex < dexLen2; dexIndex++) {
+        species = pokedex2[dexIndex];
+        GF_ASSERT(species <= BLANKSPACE);
+
+        if (species <= BLANKSPACE) {
+            inPokedex2[species >> 5] |= 1 << (species & 0x1F);
+        }
+    }
 
     *numResulting = 0;
 
-    for (int dexIndex1 = 0; dexIndex1 < dexLen1; dexIndex1++) {
-        for (dexIndex2 = 0; dexIndex2 < dexLen2; dexIndex2++) {
-            if (pokedex1[dexIndex1] == pokedex2[dexIndex2]) {
-                if (keepUncaught == TRUE) {
-                    break;
-                } else {
-                    if (Pokedex_HasCaughtSpecies(pokedex, pokedex1[dexIndex1])) {
-                        break;
-                    }
-                }
-            }
+    // Walk pokedex1 so that the result keeps its order
+    for (dexIndex = 0; dexIndex < dexLen1; dexIndex++) {
+        species = pokedex1[dexIndex];
+
+        if (species > BLANKSPACE || (inPokedex2[species >> 5] & (1 << (species & 0x1F))) == 0) {
+            continue;
         }
 
-        if (dexIndex2 < dexLen2) {
-            resultingPokedex[*numResulting] = pokedex1[dexIndex1];
+        if (keepUncaught == TRUE || Pokedex_HasCaughtSpecies(pokedex, species)) {
+            resultingPokedex[*numResulting] = species;
             (*numResulting)++;
         }
     }
@@ -30,7 +30,7 @@ void ov22_02259098(UnkStruct_ov22_0225A0E4 *param0, ArchivedSprite *param1)
     v0 = LoadMemberFromNARC(param1->archive, param1->character, 0, 14, 0);
     v1 = ov22_02255340(param0, v0, (100 + 18));
 
-    sub_020093A0((u8 *)v1->pRawData, param1->archive);
+    PokemonSprite_DecryptCharacterData(v1, param1->archive);
 }
 
 void ov22_022590C0(UnkStruct_020298D8 *param0, UnkStruct_02007768 *param1, Pokemon *param2, ArchivedSprite *param3, int param4)
@@ -69,7 +69,7 @@ void ov22_022590D4(UnkStruct_020298D8 *param0, UnkStruct_02007768 *param1, Pokem
         v4 = LoadMemberFromNARC(param3->archive, param3->character, 0, param4, 0);
 
         NNS_G2dGetUnpackedCharacterData(v4, &v5);
-        sub_020093A0((u8 *)v5->pRawData, param3->archive);
+        PokemonSprite_DecryptCharacterData(v5, param3->archive);
 
         if (param5 == 0) {
             ov22_022593B8(v5->pRawData, v5->W * 8, v5->H * 8, &param0->unk_08);
@@ -461,7 +461,7 @@ static void ov75_021D131C(void *param0)
         SpriteSystem_TransferOam();
     }
 
-    NNS_GfdDoVramTransfer();
+    VramTransfer_Process();
     Bg_RunScheduledUpdates(v0->unk_18);
 
     OS_SetIrqCheckFlag(OS_IE_V_BLANK);
@@ -25,6 +25,7 @@
 #include "unk_0200F174.h"
 #include "unk_0201E3D8.h"
 #include "unk_0208C098.h"
+#include "vram_transfer.h"
 
 int ov80_021D0D80(OverlayManager *param0, int *param1);
 int ov80_021D0DD8(OverlayManager *param0, int *param1);
@@ -170,7 +171,7 @@ static void ov80_021D0E68(void *param0)
         (Unk_ov80_021D2E94[v0->unk_00].unk_20)(v0);
     }
 
-    NNS_GfdDoVramTransfer();
+    VramTransfer_Process();
 
     ov80_021D2AEC(v0);
     Bg_RunScheduledUpdates(v0->unk_28);
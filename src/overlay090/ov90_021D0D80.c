@@ -306,7 +306,7 @@ static void ov90_021D1034(void *param0)
     UnkStruct_ov90_021D0ECC *v0 = param0;
 
     ov90_021D1BA4();
-    NNS_GfdDoVramTransfer();
+    VramTransfer_Process();
     Bg_RunScheduledUpdates(v0->unk_10);
     OS_SetIrqCheckFlag(OS_IE_V_BLANK);
 }
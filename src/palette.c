@@ -11,6 +11,15 @@
 #include "sys_task.h"
 #include "sys_task_manager.h"
 
+#define FADE_BLEND_TABLE_SIZE 32
+
+// Blended value of every channel intensity for one fade step, pre-shifted into place
+typedef struct FadeBlendTable {
+    u16 r[FADE_BLEND_TABLE_SIZE];
+    u16 g[FADE_BLEND_TABLE_SIZE];
+    u16 b[FADE_BLEND_TABLE_SIZE];
+} FadeBlendTable;
+
 static u8 IsMaskedOn(u16 mask, u16 bit);
 static void FlagFadedPaletteBuffer(PaletteData *paletteData, u16 bufferID);
 static void FilterMaskToValidPalettes(int bufferID, PaletteBuffer *buffer, u16 *outMask);
@@ -19,7 +28,8 @@ static void WaitAndApplyBlendStepToStdPaletteBuffers(PaletteData *paletteData);
 static void WaitAndApplyBlendStepToExtPaletteBuffers(PaletteData *paletteData);
 static void WaitAndApplyBlendStepToPaletteBuffer(PaletteData *paletteData, u16 bufferID, u16 paletteSize);
 static void ApplyBlendStepToPaletteBuffer(PaletteData *paletteData, u16 bufferID, u16 paletteSize);
-static void ApplyBlendStepToSinglePalette(u16 *unfaded, u16 *faded, PaletteFadeControl *fade, u32 paletteSize);
+static void BuildFadeBlendTable(FadeBlendTable *table, u16 target, u8 fraction);
+static void ApplyBlendStepToSinglePalette(const u16 *unfaded, u16 *faded, const FadeBlendTable *table, u32 paletteSize);
 static void UpdateFadeBlendStep(PaletteData *paletteData, u8 bufferID, PaletteFadeControl *fade);
 
 static void SysTask_FadePalette(SysTask *task, void *data);
@@ -302,28 +312,48 @@ static void WaitAndApplyBlendStepToPaletteBuffer(PaletteData *paletteData, u16 b
 
 static void ApplyBlendStepToPaletteBuffer(PaletteData *paletteData, u16 bufferID, u16 paletteSize)
 {
+    FadeBlendTable table;
+
+    if (paletteData->buffers[bufferID].selected.unfadedMask != 0) {
+        BuildFadeBlendTable(&table, paletteData->buffers[bufferID].selected.target, paletteData->buffers[bufferID].selected.cur);
+    }
+
     for (u32 i = 0; i < SLOTS_PER_PALETTE; i++) {
         if (!IsMaskedOn(paletteData->buffers[bufferID].selected.unfadedMask, i)) {
             continue;
         }
 
-        ApplyBlendStepToSinglePalette(&paletteData->buffers[bufferID].unfaded[i * paletteSize], &paletteData->buffers[bufferID].faded[i * paletteSize], &paletteData->buffers[bufferID].selected, paletteSize);
+        ApplyBlendStepToSinglePalette(&paletteData->buffers[bufferID].unfaded[i * paletteSize], &paletteData->buffers[bufferID].faded[i * paletteSize], &table, paletteSize);
     }
 
     UpdateFadeBlendStep(paletteData, bufferID, &paletteData->buffers[bufferID].selected);
 }
 
-static void ApplyBlendStepToSinglePalette(u16 *unfaded, u16 *faded, PaletteFadeControl *fade, u32 paletteSize)
+static void BuildFadeBlendTable(FadeBlendTable *table, u16 target, u8 fraction)
 {
-    u32 i;
     u8 r, g, b;
 
-    for (i = 0; i < paletteSize; i++) {
-        r = BlendColor(ColorR(unfaded[i]), ColorR(fade->target), fade->cur);
-        g = BlendColor(ColorG(unfaded[i]), ColorG(fade->target), fade->cur);
-        b = BlendColor(ColorB(unfaded[i]), ColorB(fade->target), fade->cur);
+    // Channels are truncated to u8 before being packed, exactly as when each
+    // color was blended on its own
+    for (u32 i = 0; i < FADE_BLEND_TABLE_SIZE; i++) {
+        r = BlendColor((int)i, ColorR(target), fraction);
+        g = BlendColor((int)i, ColorG(target), fraction);
+        b = BlendColor((int)i, ColorB(target), fraction);
 
-        faded[i] = RGB(r, g, b);
+        table->r[i] = r;
+        table->g[i] = g << 5;
+        table->b[i] = b << 10;
+    }
+}
+
+static void ApplyBlendStepToSinglePalette(const u16 *unfaded, u16 *faded, const FadeBlendTable *table, u32 paletteSize)
+{
+    u32 i;
+    u16 color;
+
+    for (i = 0; i < paletteSize; i++) {
+        color = unfaded[i];
+        faded[i] = table->r[ColorR(color)] | table->g[ColorG(color)] | table->b[ColorB(color)];
     }
 }
 
@@ -36,6 +36,7 @@ static const u16 sExcludedMonsLocal[] = {};
 #define UNOWN_COUNT           28
 #define DEOXYS_COUNT          4
 #define ROTOM_COUNT           6
+#define LAST_DEX_WORD_MASK    (0xFFFFFFFF >> (DEX_SIZE_U32 * 32 - NATIONAL_DEX_COUNT))
 
 typedef struct Pokedex {
     u32 magic;
@@ -727,6 +728,37 @@ static BOOL CountsForDexCompletion_Local(u16 species)
     return included;
 }
 
+/*
+ * Counts the species whose bit is set in every given array. Bits are laid out
+ * as (species - 1), so the last word is masked to the valid species range.
+ */
+static u16 CountDexBits(const u32 *bits, const u32 *andBits, const u32 *mask)
+{
+    int i;
+    u32 word;
+    u16 count = 0;
+
+    for (i = 0; i < DEX_SIZE_U32; i++) {
+        word = bits[i];
+
+        if (andBits != NULL) {
+            word &= andBits[i];
+        }
+
+        if (mask != NULL) {
+            word &= mask[i];
+        }
+
+        if (i == DEX_SIZE_U32 - 1) {
+            word &= LAST_DEX_WORD_MASK;
+        }
+
+        count += MATH_CountPopulation(word);
+    }
+
+    return count;
+}
+
 void Pokedex_Init(Pokedex *pokedexData)
 {
     memset(pokedexData, 0, sizeof(Pokedex));
@@ -750,31 +782,13 @@ void Pokedex_Init(Pokedex *pokedexData)
 u16 Pokedex_CountCaught_National(const Pokedex *pokedexData)
 {
     CheckPokedexIntegrity(pokedexData);
-
-    int species;
-    int caughtCount = 0;
-    for (species = 1; species <= NATIONAL_DEX_COUNT; species++) {
-        if (Pokedex_HasCaughtSpecies(pokedexData, species) == TRUE) {
-            caughtCount++;
-        }
-    }
-
-    return caughtCount;
+    return CountDexBits(pokedexData->caughtPokemon, pokedexData->seenPokemon, NULL);
 }
 
 u16 Pokedex_CountSeen_National(const Pokedex *pokedex)
 {
     CheckPokedexIntegrity(pokedex);
-
-    int species;
-    int seenCount = 0;
-    for (species = 1; species <= NATIONAL_DEX_COUNT; species++) {
-        if (Pokedex_HasSeenSpecies(pokedex, species) == TRUE) {
-            seenCount++;
-        }
-    }
-
-    return seenCount;
+    return CountDexBits(pokedex->seenPokemon, NULL, NULL);
 }
 
 u16 Pokedex_CountSeen(const Pokedex *pokedex)
@@ -789,33 +803,13 @@ u16 Pokedex_CountSeen(const Pokedex *pokedex)
 u16 Pokedex_CountCaught_Local(const Pokedex *pokedexData)
 {
     CheckPokedexIntegrity(pokedexData);
-
-    int species;
-    int caughtCount = 0;
-    for (species = 1; species <= NATIONAL_DEX_COUNT; species++) {
-        if (Pokedex_HasCaughtSpecies(pokedexData, species) == TRUE) {
-            if (Pokemon_SinnohDexNumber(species) != 0) {
-                caughtCount++;
-            }
-        }
-    }
-
-    return caughtCount;
+    return CountDexBits(pokedexData->caughtPokemon, pokedexData->seenPokemon, Pokemon_GetSinnohDexMask());
 }
 
 u16 Pokedex_CountSeen_Local(const Pokedex *pokedex)
 {
     CheckPokedexIntegrity(pokedex);
-
-    int species;
-    int seenCount = 0;
-    for (species = 1; species <= NATIONAL_DEX_COUNT; species++) {
-        if (Pokedex_HasSeenSpecies(pokedex, species) == TRUE && Pokemon_SinnohDexNumber(species) != 0) {
-            seenCount++;
-        }
-    }
-
-    return seenCount;
+    return CountDexBits(pokedex->seenPokemon, NULL, Pokemon_GetSinnohDexMask());
 }
 
 BOOL Pokedex_NationalDexCompleted(const Pokedex *pokedexData)
@@ -861,9 +855,11 @@ u16 Pokedex_NumCaught_Local(const Pokedex *pokedexData)
     int species;
     u16 numCaught = 0;
 
+    const u32 *sinnohDexMask = Pokemon_GetSinnohDexMask();
+
     for (species = 1; species <= NATIONAL_DEX_COUNT; species++) {
         if (Pokedex_HasSeenSpecies(pokedexData, species) == TRUE) {
-            if (Pokemon_SinnohDexNumber(species) != 0
+            if (ReadBit_2Forms((const u8 *)sinnohDexMask, species)
                 && CountsForDexCompletion_Local(species) == TRUE) {
                 numCaught++;
             }
@@ -59,6 +59,7 @@
 #include "unk_02092494.h"
 
 #define FATEFUL_ENCOUNTER_LOCATION 3002
+#define DEX_MASK_SIZE_U32          ((NATIONAL_DEX_COUNT - 1) / 32 + 1)
 
 // Columns: Spicy, Dry, Sweet, Bitter, Sour
 // TODO enum here?
@@ -97,6 +98,13 @@ enum PokemonDataBlockID {
     DATA_BLOCK_D
 };
 
+static u16 *sSinnohDexNumbers = NULL;
+static u16 *sNationalDexNumbers = NULL;
+static u32 sNumSinnohDexNumbers;
+static u32 sNumNationalDexNumbers;
+static u32 sSinnohDexMask[DEX_MASK_SIZE_U32];
+static BOOL sSinnohDexMaskBuilt = FALSE;
+
 static void sub_02073E18(BoxPokemon *boxMon, int monSpecies, int monLevel, int monIVs, BOOL useMonPersonalityParam, u32 monPersonality, int monOTIDSource, u32 monOTID);
 static u32 Pokemon_GetDataInternal(Pokemon *mon, enum PokemonDataParam param, void *dest);
 static u32 BoxPokemon_GetDataInternal(BoxPokemon *boxMon, enum PokemonDataParam param, void *dest);
@@ -3792,6 +3800,10 @@ u16 Pokemon_SinnohDexNumber(u16 species)
 {
     u16 result;
 
+    if (species < sNumSinnohDexNumbers) {
+        return sSinnohDexNumbers[species];
+    }
+
     NARC_ReadFromMemberByIndexPair(&result, NARC_INDEX_POKETOOL__PL_POKEZUKAN, 0, species * 2, 2);
 
     return result;
@@ -3802,12 +3814,52 @@ u16 Pokemon_NationalDexNumber(u16 sinnohDexNumber)
     u16 result = 0;
 
     if (sinnohDexNumber <= LOCAL_DEX_COUNT) {
+        if (sinnohDexNumber < sNumNationalDexNumbers) {
+            return sNationalDexNumbers[sinnohDexNumber];
+        }
+
         NARC_ReadFromMemberByIndexPair(&result, NARC_INDEX_POKETOOL__SHINZUKAN, 0, sinnohDexNumber * 2, 2);
     }
 
     return result;
 }
 
+static void BuildSinnohDexMask(void)
+{
+    int species;
+
+    memset(sSinnohDexMask, 0, sizeof(sSinnohDexMask));
+
+    for (species = 1; species <= NATIONAL_DEX_COUNT; species++) {
+        if (Pokemon_SinnohDexNumber(species) != 0) {
+            sSinnohDexMask[(species - 1) >> 5] |= 1 << ((species - 1) & 0x1F);
+        }
+    }
+
+    sSinnohDexMaskBuilt = TRUE;
+}
+
+void Pokemon_LoadDexNumberTables(u32 heapID)
+{
+    GF_ASSERT(sSinnohDexNumbers == NULL);
+
+    sSinnohDexNumbers = NARC_AllocAndReadWholeMemberByIndexPair(NARC_INDEX_POKETOOL__PL_POKEZUKAN, 0, heapID);
+    sNumSinnohDexNumbers = NARC_GetMemberSizeByIndexPair(NARC_INDEX_POKETOOL__PL_POKEZUKAN, 0) / sizeof(u16);
+    sNationalDexNumbers = NARC_AllocAndReadWholeMemberByIndexPair(NARC_INDEX_POKETOOL__SHINZUKAN, 0, heapID);
+    sNumNationalDexNumbers = NARC_GetMemberSizeByIndexPair(NARC_INDEX_POKETOOL__SHINZUKAN, 0) / sizeof(u16);
+
+    BuildSinnohDexMask();
+}
+
+const u32 *Pokemon_GetSinnohDexMask(void)
+{
+    if (!sSinnohDexMaskBuilt) {
+        BuildSinnohDexMask();
+    }
+
+    return sSinnohDexMask;
+}
+
 void Pokemon_Copy(Pokemon *src, Pokemon *dest)
 {
     *dest = *src;
@@ -40,6 +40,43 @@ enum RenderState {
     RENDER_STATE_PAUSE,
 };
 
+static void TextPrinter_SetColor(TextPrinter *printer, u16 color)
+{
+    if (color == CHAR_CONTROL_SET_COLOR_FROM_CACHE) {
+        u8 cacheColor = printer->template.cacheColor;
+
+        printer->template.cacheColor = (printer->template.fgColor - 1) / 2 + COLOR_CACHE_OFFSET;
+
+        if (!COLOR_CACHE_IS_VALID(cacheColor)) {
+            return;
+        }
+
+        color = cacheColor - COLOR_CACHE_OFFSET;
+    } else if (color >= COLOR_CACHE_OFFSET) {
+        printer->template.cacheColor = color;
+        return;
+    }
+
+    printer->template.fgColor = color * 2 + 1;
+    printer->template.shadowColor = color * 2 + 2;
+
+    Text_GenerateFontHalfRowLookupTable(printer->template.fgColor, printer->template.bgColor, printer->template.shadowColor);
+}
+
+static void TextPrinter_SetSize(TextPrinter *printer, u16 percentScale)
+{
+    switch (percentScale) {
+    case 100:
+        printer->template.glyphTable = 0;
+        printer->template.dummy1A = 0;
+        break;
+    case 200:
+        printer->template.glyphTable = 0xfffc;
+        printer->template.dummy1A = 0;
+        break;
+    }
+}
+
 enum RenderResult RenderText(TextPrinter *printer)
 {
     TextPrinterSubstruct *substruct = (TextPrinterSubstruct *)printer->substruct;
@@ -91,29 +128,9 @@ enum RenderResult RenderText(TextPrinter *printer)
             currChar = CharCode_FormatArgType(printer->template.toPrint.raw);
 
             switch (currChar) {
-            case CHAR_CONTROL_SET_COLOR: {
-                u16 color = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
-
-                if (color == CHAR_CONTROL_SET_COLOR_FROM_CACHE) {
-                    u8 cacheColor = printer->template.cacheColor;
-
-                    printer->template.cacheColor = (printer->template.fgColor - 1) / 2 + COLOR_CACHE_OFFSET;
-
-                    if (!COLOR_CACHE_IS_VALID(cacheColor)) {
-                        break;
-                    }
-
-                    color = cacheColor - COLOR_CACHE_OFFSET;
-                } else if (color >= COLOR_CACHE_OFFSET) {
-                    printer->template.cacheColor = color;
-                    break;
-                }
-
-                printer->template.fgColor = color * 2 + 1;
-                printer->template.shadowColor = color * 2 + 2;
-
-                Text_GenerateFontHalfRowLookupTable(printer->template.fgColor, printer->template.bgColor, printer->template.shadowColor);
-            } break;
+            case CHAR_CONTROL_SET_COLOR:
+                TextPrinter_SetColor(printer, CharCode_FormatArgParam(printer->template.toPrint.raw, 0));
+                break;
 
             case CHAR_CONTROL_SCREEN_INDICATOR: {
                 // 0 -> touch the bottom screen
@@ -148,20 +165,9 @@ enum RenderResult RenderText(TextPrinter *printer)
                 printer->template.currY = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
                 break;
 
-            case CHAR_CONTROL_SET_SIZE: {
-                u16 percentScale = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
-
-                switch (percentScale) {
-                case 100:
-                    printer->template.glyphTable = 0;
-                    printer->template.dummy1A = 0;
-                    break;
-                case 200:
-                    printer->template.glyphTable = 0xfffc;
-                    printer->template.dummy1A = 0;
-                    break;
-                }
-            } break;
+            case CHAR_CONTROL_SET_SIZE:
+                TextPrinter_SetSize(printer, CharCode_FormatArgParam(printer->template.toPrint.raw, 0));
+                break;
 
             case CHAR_CONTROL_MOVE: {
                 u16 param = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
@@ -273,6 +279,150 @@ enum RenderResult RenderText(TextPrinter *printer)
     return RENDER_FINISH;
 }
 
+/*
+ * Whether the printer is between characters rather than paused, clearing or
+ * scrolling, which is the only state RenderTextInstant can continue from.
+ */
+BOOL RenderText_IsAtCharBoundary(const TextPrinter *printer)
+{
+    return printer->state == RENDER_STATE_HANDLE_CHAR;
+}
+
+/*
+ * Renders as much of the string as possible in a single pass for printers
+ * with no render delay, skipping the per-glyph input and delay handling of
+ * RenderText. Each glyph or callback counts as one step, matching how many
+ * RenderText calls the incremental path would have made.
+ *
+ * Control codes which need the state machine (pauses, clears and scrolls)
+ * update the printer state and return RENDER_UPDATE, after which the caller
+ * should fall back to RenderText until the printer is back in the character
+ * handling state.
+ */
+enum RenderResult RenderTextInstant(TextPrinter *printer, u32 *steps, u32 maxSteps)
+{
+    Window *window = printer->template.window;
+    TextPrinterSubstruct *substruct = (TextPrinterSubstruct *)printer->substruct;
+    charcode_t currChar;
+
+    GF_ASSERT(printer->textSpeedBottom == 0);
+
+    if (printer->state != RENDER_STATE_HANDLE_CHAR) {
+        return RENDER_UPDATE;
+    }
+
+    printer->delayCounter = 0;
+
+    while (*steps < maxSteps) {
+        currChar = *printer->template.toPrint.raw;
+        printer->template.toPrint.raw++;
+
+        GF_ASSERT(currChar != CHAR_COMPRESSED_MARK);
+
+        switch (currChar) {
+        case CHAR_EOS:
+            return RENDER_FINISH;
+
+        case CHAR_CR:
+            printer->template.currX = printer->template.x;
+            printer->template.currY += Font_GetAttribute(printer->template.fontID, 1) + printer->template.lineSpacing;
+            continue;
+
+        case CHAR_PLACEHOLDER_BEGIN:
+            printer->template.toPrint.raw++;
+            continue;
+
+        case CHAR_FORMAT_ARG:
+            printer->template.toPrint.raw--;
+
+            switch (CharCode_FormatArgType(printer->template.toPrint.raw)) {
+            case CHAR_CONTROL_SET_COLOR:
+                TextPrinter_SetColor(printer, CharCode_FormatArgParam(printer->template.toPrint.raw, 0));
+                break;
+
+            case CHAR_CONTROL_SCREEN_INDICATOR:
+                Text_RenderScreenIndicator(printer, printer->template.currX, printer->template.currY, CharCode_FormatArgParam(printer->template.toPrint.raw, 0));
+
+                if (printer->textSpeedTop != 0) {
+                    Window_CopyToVRAM(window);
+                }
+                break;
+
+            case CHAR_CONTROL_PAUSE:
+                printer->delayCounter = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
+                printer->template.toPrint.raw = CharCode_SkipFormatArg(printer->template.toPrint.raw);
+                printer->state = RENDER_STATE_PAUSE;
+                (*steps)++;
+                return RENDER_UPDATE;
+
+            case CHAR_CONTROL_CALLBACK:
+                printer->callbackParam = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
+                printer->template.toPrint.raw = CharCode_SkipFormatArg(printer->template.toPrint.raw);
+                (*steps)++;
+                continue;
+
+            case CHAR_CONTROL_CURSOR_X:
+                printer->template.currX = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
+                break;
+
+            case CHAR_CONTROL_CURSOR_Y:
+                printer->template.currY = CharCode_FormatArgParam(printer->template.toPrint.raw, 0);
+                break;
+
+            case CHAR_CONTROL_SET_SIZE:
+                TextPrinter_SetSize(printer, CharCode_FormatArgParam(printer->template.toPrint.raw, 0));
+                break;
+
+            case CHAR_CONTROL_MOVE:
+                switch (CharCode_FormatArgParam(printer->template.toPrint.raw, 0)) {
+                case 0xFE01: // wait to scroll
+                    printer->state = RENDER_STATE_CLEAR;
+                    TextPrinter_InitScrollArrowAnim(printer);
+                    printer->template.toPrint.raw = CharCode_SkipFormatArg(printer->template.toPrint.raw);
+                    (*steps)++;
+                    return RENDER_UPDATE;
+                case 0xFE00: // scroll
+                    printer->state = RENDER_STATE_START_SCROLL;
+                    TextPrinter_InitScrollArrowAnim(printer);
+                    printer->template.toPrint.raw = CharCode_SkipFormatArg(printer->template.toPrint.raw);
+                    (*steps)++;
+                    return RENDER_UPDATE;
+                }
+                break;
+            }
+
+            printer->template.toPrint.raw = CharCode_SkipFormatArg(printer->template.toPrint.raw);
+            continue;
+
+        case CHAR_CONTROL_CLEAR:
+            printer->state = RENDER_STATE_CLEAR;
+            TextPrinter_InitScrollArrowAnim(printer);
+            (*steps)++;
+            return RENDER_UPDATE;
+
+        case CHAR_CONTROL_SCROLL:
+            printer->state = RENDER_STATE_START_SCROLL;
+            TextPrinter_InitScrollArrowAnim(printer);
+            (*steps)++;
+            return RENDER_UPDATE;
+        }
+
+        const TextGlyph *glyph = Font_TryLoadGlyph(substruct->fontID, currChar);
+        Window_CopyGlyph(window,
+            glyph->gfx,
+            glyph->width,
+            glyph->height,
+            printer->template.currX,
+            printer->template.currY,
+            printer->template.glyphTable);
+
+        printer->template.currX += glyph->width + printer->template.letterSpacing;
+        (*steps)++;
+    }
+
+    return RENDER_UPDATE;
+}
+
 static u16 sScrollArrowBaseTile = 0;
 
 void TextPrinter_SetScrollArrowBaseTile(u16 tile)
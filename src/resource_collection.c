@@ -10,8 +10,18 @@
 
 #define RESOURCE_ID_INVALID (-1)
 
+// Collections smaller than this are cheap enough to scan linearly, so they do
+// not get a hash index.
+#define RESOURCE_INDEX_MIN_CAPACITY 8
+#define RESOURCE_INDEX_EMPTY        (-1)
+#define RESOURCE_INDEX_HASH(id)     (((u32)(id) * 0x9E3779B1) >> 16)
+
 static Resource *ResourceCollection_AllocResource(ResourceCollection *collection);
 static void Resource_Init(Resource *resource);
+static void ResourceCollection_InitIndex(ResourceCollection *collection, enum HeapId heapID);
+static void ResourceCollection_IndexInsert(ResourceCollection *collection, Resource *resource);
+static void ResourceCollection_IndexRemove(ResourceCollection *collection, Resource *resource);
+static Resource *ResourceCollection_IndexFind(ResourceCollection *collection, int id);
 static TextureResource *TextureResourceManager_AllocTexture(const TextureResourceManager *texMgr);
 static void TextureResource_Init(TextureResource *texResource);
 static void TexRes_AllocVRam(const NNSG3dResTex *texRes, NNSGfdTexKey *texKey, NNSGfdTexKey *tex4x4Key, NNSGfdPlttKey *paletteKey);
@@ -38,6 +48,8 @@ ResourceCollection *ResourceCollection_New(s32 capacity, enum HeapId heapID)
     resMgr->capacity = capacity;
     resMgr->count = 0;
 
+    ResourceCollection_InitIndex(resMgr, heapID);
+
     return resMgr;
 }
 
@@ -46,6 +58,11 @@ void ResourceCollection_Delete(ResourceCollection *collection)
     GF_ASSERT(collection);
 
     ResourceCollection_Clear(collection);
+
+    if (collection->index) {
+        Heap_FreeToHeap(collection->index);
+    }
+
     Heap_FreeToHeap(collection->resources);
     Heap_FreeToHeap(collection);
 }
@@ -69,6 +86,8 @@ Resource *ResourceCollection_Add(ResourceCollection *collection, void *data, int
     resource->id = id;
     collection->count++;
 
+    ResourceCollection_IndexInsert(collection, resource);
+
     return resource;
 }
 
@@ -88,6 +107,8 @@ Resource *ResourceCollection_AddFromFile(ResourceCollection *collection, const c
 
     collection->count++;
 
+    ResourceCollection_IndexInsert(collection, resource);
+
     return resource;
 }
 
@@ -101,6 +122,8 @@ void ResourceCollection_Remove(ResourceCollection *collection, Resource *resourc
         resource->data = NULL;
     }
 
+    ResourceCollection_IndexRemove(collection, resource);
+
     resource->id = RESOURCE_ID_INVALID;
     collection->count--;
 }
@@ -121,6 +144,12 @@ Resource *ResourceCollection_FindResource(ResourceCollection *collection, int id
 {
     GF_ASSERT(collection);
 
+    // Looking up the invalid ID finds the first free slot, which only the
+    // linear scan reproduces.
+    if (collection->index && id != RESOURCE_ID_INVALID) {
+        return ResourceCollection_IndexFind(collection, id);
+    }
+
     for (int i = 0; i < collection->capacity; i++) {
         if (collection->resources[i].id == id) {
             return collection->resources + i;
@@ -174,6 +203,99 @@ static void Resource_Init(Resource *resource)
     resource->data = NULL;
 }
 
+static void ResourceCollection_InitIndex(ResourceCollection *collection, enum HeapId heapID)
+{
+    collection->index = NULL;
+    collection->indexMask = 0;
+
+    if (collection->capacity < RESOURCE_INDEX_MIN_CAPACITY) {
+        return;
+    }
+
+    // Keep the load factor at or below one half so probe sequences stay short.
+    u32 size = 1;
+    while (size < (u32)collection->capacity * 2) {
+        size <<= 1;
+    }
+
+    collection->index = Heap_AllocFromHeap(heapID, sizeof(s16) * size);
+    GF_ASSERT(collection->index);
+    collection->indexMask = size - 1;
+
+    for (u32 i = 0; i < size; i++) {
+        collection->index[i] = RESOURCE_INDEX_EMPTY;
+    }
+}
+
+static void ResourceCollection_IndexInsert(ResourceCollection *collection, Resource *resource)
+{
+    if (collection->index == NULL) {
+        return;
+    }
+
+    u32 pos = RESOURCE_INDEX_HASH(resource->id) & collection->indexMask;
+
+    while (collection->index[pos] != RESOURCE_INDEX_EMPTY) {
+        pos = (pos + 1) & collection->indexMask;
+    }
+
+    collection->index[pos] = resource - collection->resources;
+}
+
+static void ResourceCollection_IndexRemove(ResourceCollection *collection, Resource *resource)
+{
+    if (collection->index == NULL || resource->id == RESOURCE_ID_INVALID) {
+        return;
+    }
+
+    s16 slot = resource - collection->resources;
+    u32 mask = collection->indexMask;
+    u32 pos = RESOURCE_INDEX_HASH(resource->id) & mask;
+
+    while (collection->index[pos] != slot) {
+        GF_ASSERT(collection->index[pos] != RESOURCE_INDEX_EMPTY);
+        pos = (pos + 1) & mask;
+    }
+
+    // Shift later entries of the probe run back into the hole so that lookups
+    // never need tombstones.
+    u32 next = pos;
+
+    while (TRUE) {
+        next = (next + 1) & mask;
+
+        if (collection->index[next] == RESOURCE_INDEX_EMPTY) {
+            break;
+        }
+
+        u32 home = RESOURCE_INDEX_HASH(collection->resources[collection->index[next]].id) & mask;
+
+        if (((next - home) & mask) >= ((next - pos) & mask)) {
+            collection->index[pos] = collection->index[next];
+            pos = next;
+        }
+    }
+
+    collection->index[pos] = RESOURCE_INDEX_EMPTY;
+}
+
+static Resource *ResourceCollection_IndexFind(ResourceCollection *collection, int id)
+{
+    u32 pos = RESOURCE_INDEX_HASH(id) & collection->indexMask;
+
+    while (collection->index[pos] != RESOURCE_INDEX_EMPTY) {
+        Resource *resource = collection->resources + collection->index[pos];
+
+        if (resource->id == id) {
+            return resource;
+        }
+
+        pos = (pos + 1) & collection->indexMask;
+    }
+
+    return NULL;
+}
+
 TextureResourceManager *TextureResourceManager_New(s32 maxTextures, enum HeapId heapID)
 {
     TextureResourceManager *texMgr = Heap_AllocFromHeap(heapID, sizeof(TextureResourceManager));
@@ -286,6 +408,22 @@ TextureResource *TextureResourceManager_FindTextureResource(const TextureResourc
 {
     GF_ASSERT(texMgr);
 
+    // Textures and their resources are allocated and freed in pairs, so they
+    // normally share a slot index and the resource lookup can be reused.
+    if (texMgr->resources->index && id != RESOURCE_ID_INVALID) {
+        Resource *resource = ResourceCollection_FindResource(texMgr->resources, id);
+
+        if (resource == NULL) {
+            return NULL;
+        }
+
+        TextureResource *texResource = texMgr->textures + (resource - texMgr->resources->resources);
+
+        if (texResource->resource == resource) {
+            return texResource;
+        }
+    }
+
     for (int i = 0; i < texMgr->resources->capacity; i++) {
         // Combining these two checks into one doesn't match
         if (texMgr->textures[i].resource) {
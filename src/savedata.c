@@ -27,6 +27,14 @@ static int SaveDataState_Main(SaveData *saveData, SaveDataState *state);
 static void SaveDataState_End(SaveData *saveData, SaveDataState *state, int saveResult);
 static void SaveDataState_Cancel(SaveData *saveData, SaveDataState *state);
 static BOOL SaveBlockFooter_Erase(const SaveData *saveData, int blockID, int sectorID);
+static u32 SaveBlock_SectorMask(const SaveBlockInfo *blockInfo);
+static void SaveData_MarkTableModified(SaveData *saveData, int saveTableID);
+static void SaveData_SetSectorKeys(SaveData *saveData, const u8 *body, int sectorID);
+static void SaveDataState_UpdateSectorKeys(SaveData *saveData, SaveDataState *state, BOOL saved);
+static void SaveDataState_InitBlock(SaveData *saveData, SaveDataState *state, int blockID, u8 sectorID);
+static s32 SaveDataState_InitDirtySectors(SaveData *saveData, SaveDataState *state, int blockID, u8 sectorID);
+static s32 SaveDataState_InitFooter(SaveData *saveData, int blockID, u8 sectorID);
+static s32 SaveDataState_InitFooter_Secondary(SaveData *saveData, int blockID, u8 sectorID);
 static s32 SaveData_CardSave_Init(u32 address, void *data, u32 size);
 static BOOL SaveData_CardSave_Main(s32 lockID, BOOL lockFlag, BOOL *result);
 static void SaveData_CardSave_Error(s32 lockID, int errorID);
@@ -55,6 +63,9 @@ SaveData *SaveData_Init(void)
 
     MI_CpuClearFast(saveData->blockCounters, sizeof(saveData->blockCounters));
 
+    saveData->modifiedSectors[SECTOR_ID_PRIMARY] = 0xffffffff;
+    saveData->modifiedSectors[SECTOR_ID_BACKUP] = 0xffffffff;
+
     int loadResult = SaveData_LoadCheck(saveData);
 
     saveData->loadCheckStatus = 0;
@@ -107,12 +118,18 @@ SaveData *SaveData_Ptr(void)
 void *SaveData_SaveTable(SaveData *saveData, int saveTableID)
 {
     GF_ASSERT(saveTableID < SAVE_TABLE_ENTRY_MAX);
+
+    // Any caller with a writable pointer may change the table, so its sectors
+    // have to be written to both copies again
+    SaveData_MarkTableModified(saveData, saveTableID);
+
     return &(saveData->body.data[saveData->pageInfo[saveTableID].location]);
 }
 
 const void *SaveData_SaveTableConst(const SaveData *saveData, int saveTableID)
 {
-    return SaveData_SaveTable(saveData, saveTableID);
+    GF_ASSERT(saveTableID < SAVE_TABLE_ENTRY_MAX);
+    return &(saveData->body.data[saveData->pageInfo[saveTableID].location]);
 }
 
 BOOL SaveData_Erase(SaveData *saveData)
@@ -136,6 +153,8 @@ BOOL SaveData_Erase(SaveData *saveData)
     Heap_FreeToHeap(saveBuffer);
     SaveData_Clear(saveData);
 
+    saveData->sectorKeysValid[SECTOR_ID_PRIMARY] = 0;
+    saveData->sectorKeysValid[SECTOR_ID_BACKUP] = 0;
     saveData->dataExists = FALSE;
     SleepUnlock(SLEEP_TYPE_SAVE_DATA);
 
@@ -209,6 +228,8 @@ void SaveData_Clear(SaveData *saveData)
 {
     saveData->isNewGameData = TRUE;
     saveData->fullSaveRequired = TRUE;
+    saveData->modifiedSectors[SECTOR_ID_PRIMARY] = 0xffffffff;
+    saveData->modifiedSectors[SECTOR_ID_BACKUP] = 0xffffffff;
 
     SaveTable_Clear(&saveData->body, saveData->pageInfo);
 }
@@ -279,6 +300,11 @@ void SaveData_SaveStateCancel(SaveData *saveData)
     SaveDataState_Cancel(saveData, &saveData->state);
 }
 
+u32 SaveData_LastSaveSize(const SaveData *saveData)
+{
+    return saveData->lastSaveSize;
+}
+
 static void SaveData_CheckInfoInit(SaveCheckInfo *checkInfo)
 {
     checkInfo->valid = FALSE;
@@ -449,6 +475,7 @@ static int SaveData_LoadCheck(SaveData *saveData)
     if (SaveData_CardLoad(PRIMARY_SECTOR_START * SAVE_SECTOR_SIZE, primaryBuffer, SAVE_SECTOR_SIZE * SAVE_PAGE_MAX)) {
         SaveBlockFooter_CheckInfo(&normalInfo[SECTOR_ID_PRIMARY], saveData, (u32)primaryBuffer, SAVE_BLOCK_ID_NORMAL);
         SaveBlockFooter_CheckInfo(&boxInfo[SECTOR_ID_PRIMARY], saveData, (u32)primaryBuffer, SAVE_BLOCK_ID_BOXES);
+        SaveData_SetSectorKeys(saveData, primaryBuffer, SECTOR_ID_PRIMARY);
     } else {
         SaveData_CheckInfoInit(&normalInfo[SECTOR_ID_PRIMARY]);
         SaveData_CheckInfoInit(&boxInfo[SECTOR_ID_PRIMARY]);
@@ -457,6 +484,7 @@ static int SaveData_LoadCheck(SaveData *saveData)
     if (SaveData_CardLoad(BACKUP_SECTOR_START * SAVE_SECTOR_SIZE, backupBuffer, SAVE_SECTOR_SIZE * SAVE_PAGE_MAX)) {
         SaveBlockFooter_CheckInfo(&normalInfo[SECTOR_ID_BACKUP], saveData, (u32)backupBuffer, SAVE_BLOCK_ID_NORMAL);
         SaveBlockFooter_CheckInfo(&boxInfo[SECTOR_ID_BACKUP], saveData, (u32)backupBuffer, SAVE_BLOCK_ID_BOXES);
+        SaveData_SetSectorKeys(saveData, backupBuffer, SECTOR_ID_BACKUP);
     } else {
         SaveData_CheckInfoInit(&normalInfo[SECTOR_ID_BACKUP]);
         SaveData_CheckInfoInit(&boxInfo[SECTOR_ID_BACKUP]);
@@ -582,6 +610,9 @@ static BOOL SaveDataState_Load(SaveData *saveData)
 {
     int i;
 
+    saveData->modifiedSectors[SECTOR_ID_PRIMARY] = 0xffffffff;
+    saveData->modifiedSectors[SECTOR_ID_BACKUP] = 0xffffffff;
+
     for (i = 0; i < SAVE_BLOCK_ID_MAX; i++) {
         if (SaveBlock_Load(saveData->blockOffsets[i], &saveData->blockInfo[i], saveData->body.data) == FALSE) {
             return FALSE;
@@ -593,22 +624,164 @@ static BOOL SaveDataState_Load(SaveData *saveData)
     }
 
     for (i = 0; i < SAVE_TABLE_ENTRY_MAX; i++) {
-        saveData->pageInfo[i].checksum = CalcCRC16Checksum(SaveData_SaveTable(saveData, i), saveData->pageInfo[i].size);
+        saveData->pageInfo[i].checksum = CalcCRC16Checksum(SaveData_SaveTableConst(saveData, i), saveData->pageInfo[i].size);
+    }
+
+    // The body now matches the copy it was read from; the other copy is stale
+    for (i = 0; i < SAVE_BLOCK_ID_MAX; i++) {
+        saveData->modifiedSectors[saveData->blockOffsets[i]] &= ~SaveBlock_SectorMask(&saveData->blockInfo[i]);
     }
 
     return TRUE;
 }
 
-static s32 SaveDataState_InitBlock(SaveData *saveData, int blockID, u8 sectorID)
+static u32 SaveData_SectorRangeMask(int first, int last)
+{
+    return ((2u << last) - 1) & ~((1u << first) - 1);
+}
+
+static u32 SaveBlock_SectorMask(const SaveBlockInfo *blockInfo)
+{
+    return SaveData_SectorRangeMask(blockInfo->sectorStartPos, blockInfo->sectorStartPos + blockInfo->sectorsInUse - 1);
+}
+
+static void SaveData_MarkTableModified(SaveData *saveData, int saveTableID)
+{
+    const SavePageInfo *pageInfo = &saveData->pageInfo[saveTableID];
+    const SaveBlockInfo *blockInfo = &saveData->blockInfo[pageInfo->blockID];
+    u32 start = pageInfo->location - blockInfo->offset;
+
+    if (pageInfo->size == 0) {
+        return;
+    }
+
+    u32 sectors = SaveData_SectorRangeMask(blockInfo->sectorStartPos + start / SAVE_SECTOR_SIZE, blockInfo->sectorStartPos + (start + pageInfo->size - 1) / SAVE_SECTOR_SIZE);
+
+    saveData->modifiedSectors[SECTOR_ID_PRIMARY] |= sectors;
+    saveData->modifiedSectors[SECTOR_ID_BACKUP] |= sectors;
+}
+
+static u32 SaveBlock_SectorBodySize(const SaveBlockInfo *blockInfo, int sector)
+{
+    s32 size = (s32)(blockInfo->size - sizeof(SaveBlockFooter)) - sector * SAVE_SECTOR_SIZE;
+
+    if (size <= 0) {
+        return 0;
+    }
+
+    if (size > SAVE_SECTOR_SIZE) {
+        return SAVE_SECTOR_SIZE;
+    }
+
+    return size;
+}
+
+// Identifies the contents of one sector of a block. Sectors are written when
+// their table was handed out by SaveData_SaveTable, so the key only has to catch
+// writes through pointers that were kept across a save.
+static u32 SaveData_SectorKey(const u8 *data, u32 size)
+{
+    const u16 *data16 = (const u16 *)data;
+    u32 sum1 = 0, sum2 = 0;
+
+    for (u32 i = 0; i < size / 2; i++) {
+        sum1 += data16[i];
+        sum2 += sum1;
+    }
+
+    return (CalcCRC16Checksum(data, size) << 16) | ((sum1 ^ sum2 ^ (sum2 >> 16)) & 0xffff);
+}
+
+static void SaveData_SetSectorKeys(SaveData *saveData, const u8 *body, int sectorID)
+{
+    for (int i = 0; i < SAVE_BLOCK_ID_MAX; i++) {
+        const SaveBlockInfo *blockInfo = &saveData->blockInfo[i];
+
+        for (int j = 0; j < blockInfo->sectorsInUse; j++) {
+            u32 size = SaveBlock_SectorBodySize(blockInfo, j);
+            int pos = blockInfo->sectorStartPos + j;
+
+            if (size != 0) {
+                saveData->sectorKeys[sectorID][pos] = SaveData_SectorKey(body + blockInfo->offset + j * SAVE_SECTOR_SIZE, size);
+                saveData->sectorKeysValid[sectorID] |= (1u << pos);
+            }
+        }
+    }
+}
+
+static void SaveDataState_UpdateSectorKeys(SaveData *saveData, SaveDataState *state, BOOL saved)
+{
+    for (int i = state->startBlock; i < state->endBlock; i++) {
+        const SaveBlockInfo *blockInfo = &saveData->blockInfo[i];
+        int sectorID = !saveData->blockOffsets[i];
+
+        for (int j = 0; j < blockInfo->sectorsInUse; j++) {
+            int pos = blockInfo->sectorStartPos + j;
+
+            if (saved && SaveBlock_SectorBodySize(blockInfo, j) != 0) {
+                saveData->sectorKeys[sectorID][pos] = state->pendingSectorKeys[pos];
+                saveData->sectorKeysValid[sectorID] |= (1u << pos);
+            } else {
+                saveData->sectorKeysValid[sectorID] &= ~(1u << pos);
+            }
+        }
+    }
+}
+
+static void SaveDataState_InitBlock(SaveData *saveData, SaveDataState *state, int blockID, u8 sectorID)
 {
     const SaveBlockInfo *blockInfo = &saveData->blockInfo[blockID];
+    const u8 *blockData = saveData->body.data + blockInfo->offset;
 
     SaveBlockFooter_Set(saveData, (u32)saveData->body.data, blockID);
 
-    u32 saveOffset = SaveData_SaveOffset(sectorID, blockInfo);
-    u8 *bodyOffset = saveData->body.data + blockInfo->offset;
+    // Sectors are written when their tables were handed out for writing since
+    // this copy was last saved, or when their contents no longer match what the
+    // copy holds on the card; the footer is always rewritten.
+    u32 modified = saveData->modifiedSectors[sectorID] >> blockInfo->sectorStartPos;
+
+    saveData->modifiedSectors[sectorID] &= ~SaveBlock_SectorMask(blockInfo);
+    state->dirtySectors = 0;
+
+    for (int i = 0; i < blockInfo->sectorsInUse; i++) {
+        u32 size = SaveBlock_SectorBodySize(blockInfo, i);
+        int pos = blockInfo->sectorStartPos + i;
+
+        if (size == 0) {
+            continue;
+        }
+
+        state->pendingSectorKeys[pos] = SaveData_SectorKey(blockData + i * SAVE_SECTOR_SIZE, size);
+
+        if ((modified & (1u << i))
+            || !(saveData->sectorKeysValid[sectorID] & (1u << pos))
+            || saveData->sectorKeys[sectorID][pos] != state->pendingSectorKeys[pos]) {
+            state->dirtySectors |= (1u << i);
+        }
+    }
+}
+
+static s32 SaveDataState_InitDirtySectors(SaveData *saveData, SaveDataState *state, int blockID, u8 sectorID)
+{
+    const SaveBlockInfo *blockInfo = &saveData->blockInfo[blockID];
+    int start = 0, end;
+
+    GF_ASSERT(state->dirtySectors);
+
+    while (!(state->dirtySectors & (1u << start))) {
+        start++;
+    }
 
-    return SaveData_CardSave_Init(saveOffset, bodyOffset, blockInfo->size - sizeof(SaveBlockFooter));
+    for (end = start; end < blockInfo->sectorsInUse && (state->dirtySectors & (1u << end)); end++) {
+        state->dirtySectors &= ~(1u << end);
+    }
+
+    u32 offset = start * SAVE_SECTOR_SIZE;
+    u32 size = (end - 1) * SAVE_SECTOR_SIZE + SaveBlock_SectorBodySize(blockInfo, end - 1) - offset;
+
+    state->bytesWritten += size;
+
+    return SaveData_CardSave_Init(SaveData_SaveOffset(sectorID, blockInfo) + offset, saveData->body.data + blockInfo->offset + offset, size);
 }
 
 static s32 SaveDataState_InitFooter(SaveData *saveData, int blockID, u8 sectorID)
@@ -641,6 +814,8 @@ static void SaveDataState_Init(SaveData *saveData, SaveDataState *state, int blo
     state->mainSequence = 0;
     state->fullSaveMode = FALSE;
     state->locked = FALSE;
+    state->dirtySectors = 0;
+    state->bytesWritten = 0;
 
     if (blockID == SAVE_BLOCK_ID_MAX) {
         if (saveData->fullSaveRequired) {
@@ -671,10 +846,19 @@ static int SaveDataState_Main(SaveData *saveData, SaveDataState *state)
 
     switch (state->mainSequence) {
     case 0:
-        state->lockID = SaveDataState_InitBlock(saveData, state->currentBlock, !saveData->blockOffsets[state->currentBlock]);
-        state->locked = TRUE;
+        SaveDataState_InitBlock(saveData, state, state->currentBlock, !saveData->blockOffsets[state->currentBlock]);
+
+        if (state->dirtySectors == 0) {
+            state->mainSequence = 3;
+            break;
+        }
+
         state->mainSequence++;
     case 1:
+        state->lockID = SaveDataState_InitDirtySectors(saveData, state, state->currentBlock, !saveData->blockOffsets[state->currentBlock]);
+        state->locked = TRUE;
+        state->mainSequence++;
+    case 2:
         if (SaveData_CardSave_Main(state->lockID, state->locked, &saveResult) == FALSE) {
             break;
         }
@@ -685,12 +869,18 @@ static int SaveDataState_Main(SaveData *saveData, SaveDataState *state)
             return SAVE_RESULT_CORRUPT;
         }
 
+        if (state->dirtySectors) {
+            state->mainSequence = 1;
+            break;
+        }
+
         state->mainSequence++;
-    case 2:
+    case 3:
         state->lockID = SaveDataState_InitFooter_Secondary(saveData, state->currentBlock, !saveData->blockOffsets[state->currentBlock]);
+        state->bytesWritten += SECONDARY_FOOTER_SIZE;
         state->locked = TRUE;
         state->mainSequence++;
-    case 3:
+    case 4:
         if (SaveData_CardSave_Main(state->lockID, state->locked, &saveResult) == FALSE) {
             break;
         }
@@ -706,11 +896,12 @@ static int SaveDataState_Main(SaveData *saveData, SaveDataState *state)
         if (state->currentBlock + 1 == state->endBlock) {
             return SAVE_RESULT_PROCEED_FINAL;
         }
-    case 4:
+    case 5:
         state->lockID = SaveDataState_InitFooter(saveData, state->currentBlock, !saveData->blockOffsets[state->currentBlock]);
+        state->bytesWritten += sizeof(SaveBlockFooter);
         state->locked = TRUE;
         state->mainSequence++;
-    case 5:
+    case 6:
         if (SaveData_CardSave_Main(state->lockID, state->locked, &saveResult) == FALSE) {
             break;
         }
@@ -738,6 +929,8 @@ static void SaveDataState_End(SaveData *saveData, SaveDataState *state, int save
 {
     int i;
 
+    SaveDataState_UpdateSectorKeys(saveData, state, saveResult != SAVE_RESULT_CORRUPT);
+
     if (saveResult == SAVE_RESULT_CORRUPT) {
         if (state->fullSaveMode) {
             saveData->globalCounter = state->globalCounterBackup;
@@ -747,6 +940,8 @@ static void SaveDataState_End(SaveData *saveData, SaveDataState *state, int save
             saveData->blockCounters[i] = state->blockCounterBackup[i];
         }
     } else {
+        saveData->lastSaveSize = state->bytesWritten;
+
         for (i = state->startBlock; i < state->endBlock; i++) {
             saveData->blockOffsets[i] = !saveData->blockOffsets[i];
         }
@@ -763,6 +958,8 @@ static void SaveDataState_Cancel(SaveData *saveData, SaveDataState *state)
 {
     int i;
 
+    SaveDataState_UpdateSectorKeys(saveData, state, FALSE);
+
     if (state->fullSaveMode) {
         saveData->globalCounter = state->globalCounterBackup;
     }
@@ -6,9 +6,6 @@
 #include "heap.h"
 #include "system.h"
 
-typedef void (*SpriteDrawFunc)(const SpriteList *, Sprite *);
-typedef void (*SpriteAnimUpdateFunc)(Sprite *);
-
 static void SpriteList_Reset(SpriteList *list);
 static enum CellAnimType SpriteResourcesHeader_GetCellType(const SpriteResourcesHeader *resourceData);
 static void Sprite_SetCellBank(const NNSG2dCellDataBank *cellBank, Sprite *sprite);
@@ -24,9 +21,7 @@ static BOOL SpriteList_InitSprite(const SpriteList *list,
     enum HeapId heapID);
 static u32 GetPaletteIndexForProxy(const NNSG2dImagePaletteProxy *paletteProxy, u32 vramType);
 static void SpriteList_DrawSprite(const SpriteList *list, Sprite *sprite);
-static void SpriteList_DrawSprite_Stub(const SpriteList *list, Sprite *sprite);
 static void Sprite_UpdateAnimInternal(Sprite *list);
-static void Sprite_UpdateAnimInternal_Stub(Sprite *list);
 static void SpriteList_Insert(SpriteList *list, Sprite *sprite);
 static void SpriteList_Remove(Sprite *sprite);
 static void SpriteList_InitSprites(SpriteList *list);
@@ -125,15 +120,6 @@ BOOL SpriteList_DeleteAll(SpriteList *list)
 
 void SpriteList_Update(const SpriteList *list)
 {
-    static const SpriteDrawFunc sDrawFuncs[] = {
-        SpriteList_DrawSprite_Stub,
-        SpriteList_DrawSprite
-    };
-    static const SpriteAnimUpdateFunc sAnimUpdateFuncs[] = {
-        Sprite_UpdateAnimInternal_Stub,
-        Sprite_UpdateAnimInternal
-    };
-
     GF_ASSERT(list);
 
     if (list->active == FALSE) {
@@ -143,8 +129,16 @@ void SpriteList_Update(const SpriteList *list)
     Sprite *sprite = list->sentinelData.next;
 
     while (sprite != &list->sentinelData) {
-        sDrawFuncs[sprite->draw](list, sprite);
-        sAnimUpdateFuncs[sprite->animate](sprite);
+        // Hidden and paused sprites are the common case in most UIs, so test
+        // the flags here rather than calling out to a stub for them.
+        if (sprite->draw) {
+            SpriteList_DrawSprite(list, sprite);
+        }
+
+        if (sprite->animate) {
+            Sprite_UpdateAnimInternal(sprite);
+        }
+
         sprite = sprite->next;
     }
 }
@@ -159,6 +153,9 @@ static void SpriteList_Reset(SpriteList *list)
 
     Sprite_Reset(&list->sentinelData);
     list->active = FALSE;
+
+    memset(list->priorityTails, 0, sizeof(list->priorityTails));
+    list->occupiedPriorities = 0;
 }
 
 void Sprite_Reset(Sprite *sprite)
@@ -305,7 +302,7 @@ void Sprite_SetAffineZRotationEx(Sprite *sprite, u16 angle, enum AffineOverwrite
 void Sprite_SetDrawFlag(Sprite *sprite, BOOL draw)
 {
     GF_ASSERT(sprite);
-    GF_ASSERT(draw < 2); // This value is used as an index into an array of size 2 inside SpriteList_Update
+    GF_ASSERT(draw < 2);
 
     sprite->draw = draw;
 }
@@ -313,7 +310,7 @@ void Sprite_SetDrawFlag(Sprite *sprite, BOOL draw)
 void Sprite_SetAnimateFlag(Sprite *sprite, BOOL animate)
 {
     GF_ASSERT(sprite);
-    GF_ASSERT(animate < 2); // This value is used as an index into an array of size 2 inside SpriteList_Update
+    GF_ASSERT(animate < 2);
 
     sprite->animate = animate;
 }
@@ -514,10 +511,12 @@ u32 Sprite_GetExplicitPaletteOffset(const Sprite *sprite)
 
 void Sprite_SetPriority(Sprite *sprite, u32 priority)
 {
-    SpriteList *list = sprite->list; // Required to match
-    sprite->priority = priority;
+    SpriteList *list = sprite->list;
 
+    // The sprite must leave the list under its old priority so that the
+    // priority tails stay consistent.
     SpriteList_Remove(sprite);
+    sprite->priority = priority;
     SpriteList_Insert(list, sprite);
 }
 
@@ -836,58 +835,58 @@ static void SpriteList_DrawSprite(const SpriteList *list, Sprite *sprite)
     NNS_G2dEndRendering();
 }
 
-static void SpriteList_DrawSprite_Stub(const SpriteList *list, Sprite *sprite)
-{
-    return;
-}
-
 static void Sprite_UpdateAnimInternal(Sprite *sprite)
 {
     Sprite_UpdateAnim(sprite, sprite->animSpeed);
 }
 
-static void Sprite_UpdateAnimInternal_Stub(Sprite *sprite)
-{
-    return;
-}
-
 static void SpriteList_Insert(SpriteList *list, Sprite *sprite)
 {
-    // If the list is empty, insert the sprite as the only sprite
-    if (list->sentinelData.next == &list->sentinelData) {
-        list->sentinelData.next = sprite;
-        list->sentinelData.prev = sprite;
-        sprite->prev = &list->sentinelData;
-        sprite->next = &list->sentinelData;
-        return;
-    }
+    Sprite *prev;
 
-    // Check if the sprite should be inserted at the end of the list (lowest priority)
-    if (list->sentinelData.prev->priority <= sprite->priority) {
-        sprite->prev = list->sentinelData.prev;
-        list->sentinelData.prev->next = sprite;
-        sprite->next = &list->sentinelData;
-        list->sentinelData.prev = sprite;
-        return;
-    }
+    // Sprites are kept sorted by priority, with a new sprite placed after every
+    // sprite of equal or lower priority. Find the sprite to insert after.
+    if (sprite->priority < SPRITE_LIST_PRIORITY_BUCKETS) {
+        // Everything at or below this priority is bucketed, so the insertion
+        // point is the tail of the highest occupied bucket up to it.
+        u32 occupied = list->occupiedPriorities & (0xFFFFFFFF >> (31 - sprite->priority));
 
-    // Insert the sprite in the correct position according to its priority
-    Sprite *cur = list->sentinelData.next;
-    while (cur != &list->sentinelData) {
-        if (cur->priority > sprite->priority) {
-            cur->prev->next = sprite;
-            sprite->prev = cur->prev;
-            cur->prev = sprite;
-            sprite->next = cur;
-            break;
+        if (occupied != 0) {
+            prev = list->priorityTails[31 - MATH_CountLeadingZeros(occupied)];
+        } else {
+            prev = &list->sentinelData;
         }
 
-        cur = cur->next;
+        list->priorityTails[sprite->priority] = sprite;
+        list->occupiedPriorities |= 1u << sprite->priority;
+    } else {
+        // Large priorities are rare and sort last, so search back from the end
+        prev = list->sentinelData.prev;
+
+        while (prev != &list->sentinelData && prev->priority > sprite->priority) {
+            prev = prev->prev;
+        }
     }
+
+    sprite->prev = prev;
+    sprite->next = prev->next;
+    prev->next->prev = sprite;
+    prev->next = sprite;
 }
 
 static void SpriteList_Remove(Sprite *sprite)
 {
+    SpriteList *list = sprite->list;
+
+    if (sprite->priority < SPRITE_LIST_PRIORITY_BUCKETS && list->priorityTails[sprite->priority] == sprite) {
+        if (sprite->prev != &list->sentinelData && sprite->prev->priority == sprite->priority) {
+            list->priorityTails[sprite->priority] = sprite->prev;
+        } else {
+            list->priorityTails[sprite->priority] = NULL;
+            list->occupiedPriorities &= ~(1u << sprite->priority);
+        }
+    }
+
     sprite->prev->next = sprite->next;
     sprite->next->prev = sprite->prev;
 }
@@ -171,12 +171,10 @@ void StringTemplate_SetCounterpartName(StringTemplate *template, u32 idx, const
 
 void StringTemplate_SetSpeciesName(StringTemplate *template, u32 idx, BoxPokemon *boxMon)
 {
-    MessageLoader *loader = InitMessageLoader(TEXT_BANK_SPECIES_NAME, template->heapID);
     u32 species = BoxPokemon_GetValue(boxMon, MON_DATA_SPECIES, NULL);
 
-    MessageLoader_GetStrbuf(loader, species, template->templateBuf);
+    MessageCache_GetStrbuf(TEXT_BANK_SPECIES_NAME, species, template->heapID, template->templateBuf);
     SetStringTemplateArg(template, idx, template->templateBuf, NULL);
-    MessageLoader_Free(loader);
 }
 
 void StringTemplate_SetSpeciesNameWithArticle(StringTemplate *template, u32 idx, BoxPokemon *boxMon)
@@ -186,11 +184,8 @@ void StringTemplate_SetSpeciesNameWithArticle(StringTemplate *template, u32 idx,
 
 void StringTemplate_SetSpeciesNameWithArticleByID(StringTemplate *template, u32 idx, u32 species)
 {
-    MessageLoader *loader = InitMessageLoader(TEXT_BANK_SPECIES_NAME_WITH_ARTICLES, template->heapID);
-
-    MessageLoader_GetStrbuf(loader, species, template->templateBuf);
+    MessageCache_GetStrbuf(TEXT_BANK_SPECIES_NAME_WITH_ARTICLES, species, template->heapID, template->templateBuf);
     SetStringTemplateArg(template, idx, template->templateBuf, NULL);
-    MessageLoader_Free(loader);
 }
 
 void StringTemplate_SetNickname(StringTemplate *template, u32 idx, BoxPokemon *boxMon)
@@ -213,13 +208,8 @@ void StringTemplate_SetNumber(StringTemplate *template, u32 idx, int num, u32 ma
 
 static inline void SetArgFromArchive(StringTemplate *template, u32 idx, u32 argVal, u32 bankID)
 {
-    MessageLoader *loader = InitMessageLoader(bankID, template->heapID);
-
-    if (loader) {
-        MessageLoader_GetStrbuf(loader, argVal, template->templateBuf);
-        SetStringTemplateArg(template, idx, template->templateBuf, NULL);
-        MessageLoader_Free(loader);
-    }
+    MessageCache_GetStrbuf(bankID, argVal, template->heapID, template->templateBuf);
+    SetStringTemplateArg(template, idx, template->templateBuf, NULL);
 }
 
 void StringTemplate_SetMoveName(StringTemplate *template, u32 idx, enum Move move)
@@ -239,11 +229,7 @@ void StringTemplate_SetAbilityName(StringTemplate *template, u32 idx, enum Abili
 
 void StringTemplate_SetNatureName(StringTemplate *template, u32 idx, u32 nature)
 {
-    MessageLoader *loader = InitMessageLoader(TEXT_BANK_NATURE_NAMES, template->heapID);
-
-    MessageLoader_GetStrbuf(loader, nature, template->templateBuf);
-    SetStringTemplateArg(template, idx, template->templateBuf, NULL);
-    MessageLoader_Free(loader);
+    SetArgFromArchive(template, idx, nature, TEXT_BANK_NATURE_NAMES);
 }
 
 void StringTemplate_SetItemName(StringTemplate *template, u32 idx, u32 item)
@@ -320,13 +306,7 @@ void StringTemplate_SetTrainerClassNameWithArticle(StringTemplate *template, u32
 
 void StringTemplate_SetTrainerClassNameBattle(StringTemplate *template, u32 idx, Trainer *trainer)
 {
-    MessageLoader *loader = InitMessageLoader(TEXT_BANK_TRAINER_CLASS_NAMES, template->heapID);
-
-    if (loader) {
-        MessageLoader_GetStrbuf(loader, trainer->header.trainerType, template->templateBuf);
-        SetStringTemplateArg(template, idx, template->templateBuf, NULL);
-        MessageLoader_Free(loader);
-    }
+    SetArgFromArchive(template, idx, trainer->header.trainerType, TEXT_BANK_TRAINER_CLASS_NAMES);
 }
 
 void StringTemplate_SetTrainerName(StringTemplate *template, u32 idx, u32 trainerID)
@@ -583,11 +563,7 @@ void StringTemplate_SetESGreeting(StringTemplate *template, u32 idx, u32 greetin
 
 void StringTemplate_SetFurniture(StringTemplate *template, u32 idx, u32 furniture)
 {
-    MessageLoader *loader = InitMessageLoader(TEXT_BANK_FURNITURE_NAMES, template->heapID);
-
-    MessageLoader_GetStrbuf(loader, furniture, template->templateBuf);
-    SetStringTemplateArg(template, idx, template->templateBuf, NULL);
-    MessageLoader_Free(loader);
+    SetArgFromArchive(template, idx, furniture, TEXT_BANK_FURNITURE_NAMES);
 }
 
 void StringTemplate_SetMonthName(StringTemplate *template, u32 idx, u32 month)
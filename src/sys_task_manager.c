@@ -9,6 +9,14 @@ static void SysTaskManager_InitTasks(SysTaskManager *sysTaskMgr);
 static SysTask *SysTaskManager_AllocTask(SysTaskManager *sysTaskMgr);
 static BOOL SysTaskManager_FreeTask(SysTaskManager *sysTaskMgr, SysTask *task);
 static SysTask *SysTaskManager_InternalAddTask(SysTaskManager *sysTaskMgr, SysTaskFunc callback, void *param, u32 priority);
+static u32 SysTaskManager_FindPriorityGroup(SysTaskManager *sysTaskMgr, u32 priority);
+static SysTask *SysTaskManager_AddToPriorityGroup(SysTaskManager *sysTaskMgr, SysTask *task);
+static void SysTaskManager_RemoveFromPriorityGroup(SysTaskManager *sysTaskMgr, SysTask *task);
+
+#ifdef SYS_TASK_PROFILING
+static SysTaskProfileEntry *SysTaskProfile_Record(SysTaskProfile *profile, SysTaskFunc callback, u32 ticks);
+static void SysTaskProfile_EndFrame(SysTaskManager *sysTaskMgr, u32 frameTicks, SysTaskProfileEntry *heaviest);
+#endif
 
 static void SysTaskManager_InitTask(SysTaskManager *sysTaskMgr, SysTask *task)
 {
@@ -61,7 +69,7 @@ static BOOL SysTaskManager_FreeTask(SysTaskManager *sysTaskMgr, SysTask *task)
 
 u32 SysTaskManager_GetRequiredSize(u32 maxTasks)
 {
-    return sizeof(SysTaskManager) + (sizeof(SysTask *) + sizeof(SysTask)) * maxTasks;
+    return sizeof(SysTaskManager) + (sizeof(SysTask *) + sizeof(SysTask) + sizeof(SysTaskPriorityGroup)) * maxTasks;
 }
 
 SysTaskManager *SysTaskManager_Init(u32 maxTasks, void *memory)
@@ -71,6 +79,7 @@ SysTaskManager *SysTaskManager_Init(u32 maxTasks, void *memory)
 
     sysTaskMgr->taskStack = (SysTask **)((u8 *)(sysTaskMgr) + sizeof(SysTaskManager));
     sysTaskMgr->tasks = (SysTask *)((u8 *)(sysTaskMgr->taskStack) + sizeof(SysTask *) * maxTasks);
+    sysTaskMgr->priorityGroups = (SysTaskPriorityGroup *)((u8 *)(sysTaskMgr->tasks) + sizeof(SysTask) * maxTasks);
     sysTaskMgr->maxTasks = maxTasks;
     sysTaskMgr->stackPointer = 0;
     sysTaskMgr->locked = FALSE;
@@ -82,6 +91,7 @@ SysTaskManager *SysTaskManager_Init(u32 maxTasks, void *memory)
 void SysTaskManager_InternalInit(SysTaskManager *sysTaskMgr)
 {
     SysTaskManager_InitTasks(sysTaskMgr);
+    sysTaskMgr->numPriorityGroups = 0;
 
     sysTaskMgr->sentinelTask.manager = sysTaskMgr;
     sysTaskMgr->sentinelTask.prevTask = sysTaskMgr->sentinelTask.nextTask = &sysTaskMgr->sentinelTask;
@@ -90,6 +100,10 @@ void SysTaskManager_InternalInit(SysTaskManager *sysTaskMgr)
     sysTaskMgr->sentinelTask.callback = NULL;
 
     sysTaskMgr->currentTask = sysTaskMgr->sentinelTask.nextTask;
+
+#ifdef SYS_TASK_PROFILING
+    SysTaskManager_ResetProfile(sysTaskMgr);
+#endif
 }
 
 void SysTaskManager_ExecuteTasks(SysTaskManager *sysTaskMgr)
@@ -98,6 +112,12 @@ void SysTaskManager_ExecuteTasks(SysTaskManager *sysTaskMgr)
         return;
     }
 
+#ifdef SYS_TASK_PROFILING
+    OSTick frameStart = OS_GetTick();
+    SysTaskProfileEntry *heaviest = NULL;
+    u32 heaviestTicks = 0;
+#endif
+
     sysTaskMgr->currentTask = sysTaskMgr->sentinelTask.nextTask;
 
     while (sysTaskMgr->currentTask != &sysTaskMgr->sentinelTask) {
@@ -105,7 +125,21 @@ void SysTaskManager_ExecuteTasks(SysTaskManager *sysTaskMgr)
 
         if (sysTaskMgr->currentTask->state == TASK_STATE_ACTIVE) {
             if (sysTaskMgr->currentTask->callback != NULL) {
+#ifdef SYS_TASK_PROFILING
+                // The callback may delete its own task, so keep hold of it first
+                SysTaskFunc callback = sysTaskMgr->currentTask->callback;
+                OSTick start = OS_GetTick();
+#endif
                 sysTaskMgr->currentTask->callback(sysTaskMgr->currentTask, sysTaskMgr->currentTask->param);
+#ifdef SYS_TASK_PROFILING
+                u32 ticks = (u32)(OS_GetTick() - start);
+                SysTaskProfileEntry *entry = SysTaskProfile_Record(&sysTaskMgr->profile, callback, ticks);
+
+                if (entry != NULL && ticks >= heaviestTicks) {
+                    heaviest = entry;
+                    heaviestTicks = ticks;
+                }
+#endif
             }
         } else {
             sysTaskMgr->currentTask->state = TASK_STATE_ACTIVE;
@@ -115,6 +149,10 @@ void SysTaskManager_ExecuteTasks(SysTaskManager *sysTaskMgr)
     }
 
     sysTaskMgr->currentTask->callback = NULL;
+
+#ifdef SYS_TASK_PROFILING
+    SysTaskProfile_EndFrame(sysTaskMgr, (u32)(OS_GetTick() - frameStart), heaviest);
+#endif
 }
 
 SysTask *SysTaskManager_AddTask(SysTaskManager *sysTaskMgr, SysTaskFunc callback, void *param, u32 priority)
@@ -150,34 +188,80 @@ static SysTask *SysTaskManager_InternalAddTask(SysTaskManager *sysTaskMgr, SysTa
         task->state = TASK_STATE_ACTIVE;
     }
 
-    for (SysTask *taskIter = sysTaskMgr->sentinelTask.nextTask; taskIter != &sysTaskMgr->sentinelTask; taskIter = taskIter->nextTask) {
-        if (taskIter->priority > task->priority) {
-            task->prevTask = taskIter->prevTask;
-            task->nextTask = taskIter;
-            taskIter->prevTask->nextTask = task;
-            taskIter->prevTask = task;
+    // The task goes after every task with an equal or lower priority
+    SysTask *prevTask = SysTaskManager_AddToPriorityGroup(sysTaskMgr, task);
 
-            // Also update the task to be executed next, to avoid it accidentally being skipped.
-            if (taskIter == sysTaskMgr->nextTask) {
-                sysTaskMgr->nextTask = task;
-            }
+    task->prevTask = prevTask;
+    task->nextTask = prevTask->nextTask;
+    prevTask->nextTask->prevTask = task;
+    prevTask->nextTask = task;
 
-            return task;
+    // Also update the task to be executed next, to avoid it accidentally being skipped.
+    if (task->nextTask == sysTaskMgr->nextTask) {
+        sysTaskMgr->nextTask = task;
+    }
+
+    return task;
+}
+
+// Returns the index of the first group with a priority greater than the one given
+static u32 SysTaskManager_FindPriorityGroup(SysTaskManager *sysTaskMgr, u32 priority)
+{
+    u32 low = 0;
+    u32 high = sysTaskMgr->numPriorityGroups;
+
+    while (low < high) {
+        u32 mid = (low + high) / 2;
+
+        if (sysTaskMgr->priorityGroups[mid].priority <= priority) {
+            low = mid + 1;
+        } else {
+            high = mid;
         }
     }
 
-    // If the task has the lowest priority, it is added to the end of the list.
-    if (sysTaskMgr->nextTask == &sysTaskMgr->sentinelTask) {
-        sysTaskMgr->nextTask = task;
+    return low;
+}
+
+// Returns the task which the given task should be linked in after
+static SysTask *SysTaskManager_AddToPriorityGroup(SysTaskManager *sysTaskMgr, SysTask *task)
+{
+    SysTaskPriorityGroup *groups = sysTaskMgr->priorityGroups;
+    u32 i = SysTaskManager_FindPriorityGroup(sysTaskMgr, task->priority);
+    SysTask *prevTask;
+
+    if (i > 0 && groups[i - 1].priority == task->priority) {
+        prevTask = groups[i - 1].tail;
+        groups[i - 1].tail = task;
+        groups[i - 1].count++;
+
+        return prevTask;
     }
 
-    task->prevTask = sysTaskMgr->sentinelTask.prevTask;
-    task->nextTask = &sysTaskMgr->sentinelTask;
+    prevTask = i > 0 ? groups[i - 1].tail : &sysTaskMgr->sentinelTask;
 
-    sysTaskMgr->sentinelTask.prevTask->nextTask = task;
-    sysTaskMgr->sentinelTask.prevTask = task;
+    memmove(&groups[i + 1], &groups[i], sizeof(SysTaskPriorityGroup) * (sysTaskMgr->numPriorityGroups - i));
+    groups[i].priority = task->priority;
+    groups[i].tail = task;
+    groups[i].count = 1;
+    sysTaskMgr->numPriorityGroups++;
 
-    return task;
+    return prevTask;
+}
+
+static void SysTaskManager_RemoveFromPriorityGroup(SysTaskManager *sysTaskMgr, SysTask *task)
+{
+    SysTaskPriorityGroup *groups = sysTaskMgr->priorityGroups;
+    u32 i = SysTaskManager_FindPriorityGroup(sysTaskMgr, task->priority) - 1;
+
+    GF_ASSERT(i < sysTaskMgr->numPriorityGroups && groups[i].priority == task->priority);
+
+    if (--groups[i].count == 0) {
+        sysTaskMgr->numPriorityGroups--;
+        memmove(&groups[i], &groups[i + 1], sizeof(SysTaskPriorityGroup) * (sysTaskMgr->numPriorityGroups - i));
+    } else if (groups[i].tail == task) {
+        groups[i].tail = task->prevTask;
+    }
 }
 
 void SysTask_Delete(SysTask *task)
@@ -186,6 +270,8 @@ void SysTask_Delete(SysTask *task)
         task->manager->nextTask = task->nextTask;
     }
 
+    SysTaskManager_RemoveFromPriorityGroup(task->manager, task);
+
     task->prevTask->nextTask = task->nextTask;
     task->nextTask->prevTask = task->prevTask;
 
@@ -206,3 +292,101 @@ u32 SysTask_GetPriority(SysTask *task)
 {
     return task->priority;
 }
+
+#ifdef SYS_TASK_PROFILING
+static SysTaskProfileEntry *SysTaskProfile_Record(SysTaskProfile *profile, SysTaskFunc callback, u32 ticks)
+{
+    SysTaskProfileEntry *entry = NULL;
+
+    for (u32 i = 0; i < profile->numEntries; i++) {
+        if (profile->entries[i].callback == callback) {
+            entry = &profile->entries[i];
+            break;
+        }
+    }
+
+    if (entry == NULL) {
+        if (profile->numEntries >= SYS_TASK_PROFILE_MAX_CALLBACKS) {
+            profile->droppedCalls++;
+            return NULL;
+        }
+
+        entry = &profile->entries[profile->numEntries++];
+        entry->callback = callback;
+    }
+
+    entry->calls++;
+    entry->totalTicks += ticks;
+
+    if (ticks > entry->worstTicks) {
+        entry->worstTicks = ticks;
+    }
+
+    return entry;
+}
+
+static void SysTaskProfile_EndFrame(SysTaskManager *sysTaskMgr, u32 frameTicks, SysTaskProfileEntry *heaviest)
+{
+    SysTaskProfile *profile = &sysTaskMgr->profile;
+
+    profile->frames++;
+
+    if (frameTicks > profile->worstFrameTicks) {
+        profile->worstFrameTicks = frameTicks;
+    }
+
+    if (frameTicks > OS_MicroSecondsToTicks32(SYS_TASK_PROFILE_FRAME_BUDGET_US)) {
+        profile->overBudgetFrames++;
+
+        if (heaviest != NULL) {
+            heaviest->overBudgetFrames++;
+        }
+    }
+
+    if (profile->frames >= SYS_TASK_PROFILE_REPORT_FRAMES) {
+        SysTaskManager_PrintProfile(sysTaskMgr);
+        SysTaskManager_ResetProfile(sysTaskMgr);
+    }
+}
+
+// Callback addresses can be turned back into names with
+// tools/debug/symbolize_task_profile.py and the linker map.
+void SysTaskManager_PrintProfile(SysTaskManager *sysTaskMgr)
+{
+    SysTaskProfile *profile = &sysTaskMgr->profile;
+    SysTaskProfileEntry *ranked[SYS_TASK_PROFILE_MAX_CALLBACKS];
+    u32 i, j;
+
+    for (i = 0; i < profile->numEntries; i++) {
+        SysTaskProfileEntry *entry = &profile->entries[i];
+
+        for (j = i; j > 0 && ranked[j - 1]->totalTicks < entry->totalTicks; j--) {
+            ranked[j] = ranked[j - 1];
+        }
+
+        ranked[j] = entry;
+    }
+
+    OS_Printf("SYSTASK PROFILE mgr=%08X frames=%lu over=%lu worst=%luus dropped=%lu\n",
+        sysTaskMgr,
+        profile->frames,
+        profile->overBudgetFrames,
+        OS_TicksToMicroSeconds32(profile->worstFrameTicks),
+        profile->droppedCalls);
+
+    for (i = 0; i < profile->numEntries && i < SYS_TASK_PROFILE_REPORT_ENTRIES; i++) {
+        OS_Printf("SYSTASK %2lu func=%08X calls=%lu total=%luus worst=%luus over=%lu\n",
+            i,
+            ranked[i]->callback,
+            ranked[i]->calls,
+            OS_TicksToMicroSeconds32(ranked[i]->totalTicks),
+            OS_TicksToMicroSeconds32(ranked[i]->worstTicks),
+            ranked[i]->overBudgetFrames);
+    }
+}
+
+void SysTaskManager_ResetProfile(SysTaskManager *sysTaskMgr)
+{
+    memset(&sysTaskMgr->profile, 0, sizeof(SysTaskProfile));
+}
+#endif // SYS_TASK_PROFILING
@@ -17,6 +17,13 @@
 #include "sys_task.h"
 #include "sys_task_manager.h"
 
+#define MAX_INSTANT_RENDER_STEPS 1024
+
+#define FONT_HALF_ROW_LOOKUP_TABLE_CACHE_SIZE 4
+#define FONT_HALF_ROW_LOOKUP_TABLE_KEY_VALID  (1 << 24)
+#define FONT_HALF_ROW_LOOKUP_TABLE_KEY(fgColor, bgColor, shadowColor) \
+    (FONT_HALF_ROW_LOOKUP_TABLE_KEY_VALID | ((fgColor) << 16) | ((bgColor) << 8) | (shadowColor))
+
 static enum RenderResult TextPrinter_Render(TextPrinter *printer);
 static u8 Text_CreatePrinterTask(SysTaskFunc taskFunc, TextPrinter *printer, u32 priority);
 static void Text_DestroyPrinterTask(u8 printerID);
@@ -30,7 +37,10 @@ static const FontAttributes *sFontAttributesPtr = NULL;
 
 static u8 sPausePrinter = FALSE;
 static SysTask *sTextPrinterTasks[MAX_TEXT_PRINTERS] = { 0 };
-static u16 sFontHalfRowLookupTable[4 * 4 * 4 * 4];
+static u16 sFontHalfRowLookupTables[FONT_HALF_ROW_LOOKUP_TABLE_CACHE_SIZE][4 * 4 * 4 * 4];
+static u32 sFontHalfRowLookupTableKeys[FONT_HALF_ROW_LOOKUP_TABLE_CACHE_SIZE];
+static u8 sFontHalfRowLookupTableNextSlot;
+static const u16 *sFontHalfRowLookupTable = sFontHalfRowLookupTables[0];
 static u16 sBgColor, sFgColor, sShadowColor;
 
 void Text_SetFontAttributesPtr(const FontAttributes *fontAttributes)
@@ -207,12 +217,16 @@ u8 Text_AddPrinter(const TextPrinterTemplate *template, u32 renderDelay, TextPri
     u32 i = 0;
     Text_GenerateFontHalfRowLookupTable(template->fgColor, template->bgColor, template->shadowColor);
 
-    while (i < 1024) {
-        if (TextPrinter_Render(printer) == RENDER_FINISH) {
-            break;
-        }
+    enum RenderResult result = RENDER_UPDATE;
 
-        i++;
+    // The bulk renderer stops at control codes which need the state machine,
+    // so those are stepped through one render at a time as before.
+    while (i < MAX_INSTANT_RENDER_STEPS && result != RENDER_FINISH) {
+        if (RenderText_IsAtCharBoundary(printer)) {
+            result = Font_RenderTextInstant(printer->template.fontID, printer, &i, MAX_INSTANT_RENDER_STEPS);
+        } else if ((result = TextPrinter_Render(printer)) != RENDER_FINISH) {
+            i++;
+        }
     }
 
     if (renderDelay != TEXT_SPEED_NO_TRANSFER) {
@@ -270,6 +284,25 @@ static enum RenderResult TextPrinter_Render(TextPrinter *printer)
 
 void Text_GenerateFontHalfRowLookupTable(u8 fgColor, u8 bgColor, u8 shadowColor)
 {
+    u32 key = FONT_HALF_ROW_LOOKUP_TABLE_KEY(fgColor, bgColor, shadowColor);
+    int slot;
+
+    sBgColor = bgColor;
+    sFgColor = fgColor;
+    sShadowColor = shadowColor;
+
+    // Printers call this on every tick, so only rebuild when the colour set
+    // is not already held in one of the cached tables.
+    for (slot = 0; slot < FONT_HALF_ROW_LOOKUP_TABLE_CACHE_SIZE; slot++) {
+        if (sFontHalfRowLookupTableKeys[slot] == key) {
+            sFontHalfRowLookupTable = sFontHalfRowLookupTables[slot];
+            return;
+        }
+    }
+
+    slot = sFontHalfRowLookupTableNextSlot;
+    sFontHalfRowLookupTableNextSlot = (slot + 1) % FONT_HALF_ROW_LOOKUP_TABLE_CACHE_SIZE;
+
     u32 colors[4];
 
     colors[0] = 0;
@@ -277,20 +310,21 @@ void Text_GenerateFontHalfRowLookupTable(u8 fgColor, u8 bgColor, u8 shadowColor)
     colors[2] = shadowColor;
     colors[3] = bgColor;
 
-    sBgColor = bgColor;
-    sFgColor = fgColor;
-    sShadowColor = shadowColor;
-
+    u16 *table = sFontHalfRowLookupTables[slot];
     u32 idx = 0;
+
     for (int i = 0; i < 4; i++) {
         for (int j = 0; j < 4; j++) {
             for (int k = 0; k < 4; k++) {
                 for (int l = 0; l < 4; l++) {
-                    sFontHalfRowLookupTable[idx++] = (colors[l] << 12) | (colors[k] << 8) | (colors[j] << 4) | (colors[i]);
+                    table[idx++] = (colors[l] << 12) | (colors[k] << 8) | (colors[j] << 4) | (colors[i]);
                 }
             }
         }
     }
+
+    sFontHalfRowLookupTableKeys[slot] = key;
+    sFontHalfRowLookupTable = table;
 }
 
 void Text_DecompressGlyph(u8 *src, u8 *dst)
@@ -20,20 +20,34 @@
 #include "savedata_misc.h"
 #include "strbuf.h"
 
-static void TrainerData_BuildParty(FieldBattleDTO *dto, int battler, int heapID);
+static void TrainerData_BuildParty(FieldBattleDTO *dto, int battler, NARC *partyNARC, int heapID);
+static int TrainerData_FindLoadedBattler(FieldBattleDTO *dto, int battler);
 
 void Trainer_Encounter(FieldBattleDTO *dto, const SaveData *save, int heapID)
 {
     Trainer trdata;
     MessageLoader *msgLoader = MessageLoader_Init(MESSAGE_LOADER_NARC_HANDLE, NARC_INDEX_MSGDATA__PL_MSG, 618, heapID);
     const charcode_t *rivalName = MiscSaveBlock_RivalName(SaveData_MiscSaveBlockConst(save));
+    NARC *trainerNARC = NARC_ctor(NARC_INDEX_POKETOOL__TRAINER__TRDATA, heapID);
+    NARC *partyNARC = NARC_ctor(NARC_INDEX_POKETOOL__TRAINER__TRPOKE, heapID);
 
     for (int i = 0; i < MAX_BATTLERS; i++) {
         if (!dto->trainerIDs[i]) {
             continue;
         }
 
-        Trainer_Load(dto->trainerIDs[i], &trdata);
+        // Doubles against a single trainer list the same ID twice; the party
+        // build is deterministic per trainer, so reuse the first result.
+        int loaded = TrainerData_FindLoadedBattler(dto, i);
+
+        if (loaded != i) {
+            dto->trainer[i] = dto->trainer[loaded];
+            Party_Copy(dto->parties[loaded], dto->parties[i]);
+            trdata = dto->trainer[i];
+            continue;
+        }
+
+        NARC_ReadWholeMember(trainerNARC, dto->trainerIDs[i], &trdata);
         dto->trainer[i] = trdata;
 
         if (trdata.header.trainerType == TRAINER_CLASS_RIVAL) {
@@ -44,10 +58,12 @@ void Trainer_Encounter(FieldBattleDTO *dto, const SaveData *save, int heapID)
             Strbuf_Free(trainerName);
         }
 
-        TrainerData_BuildParty(dto, i, heapID);
+        TrainerData_BuildParty(dto, i, partyNARC, heapID);
     }
 
     dto->battleType |= trdata.header.battleType;
+    NARC_dtor(partyNARC);
+    NARC_dtor(trainerNARC);
     MessageLoader_Free(msgLoader);
 }
 
@@ -166,14 +182,34 @@ u8 TrainerClass_Gender(int trclass)
     return sTrainerClassGender[trclass];
 }
 
+/**
+ * @brief Find the first battler in the FieldBattleDTO struct which shares a
+ * trainer with the given battler.
+ *
+ * @param dto           The parent FieldBattleDTO struct containing trainer IDs.
+ * @param battler       The battler to match against.
+ * @return Index of the first matching battler; battler itself if none precede it.
+ */
+static int TrainerData_FindLoadedBattler(FieldBattleDTO *dto, int battler)
+{
+    for (int i = 0; i < battler; i++) {
+        if (dto->trainerIDs[i] == dto->trainerIDs[battler]) {
+            return i;
+        }
+    }
+
+    return battler;
+}
+
 /**
  * @brief Build the party for a trainer as loaded in the FieldBattleDTO struct.
  *
  * @param dto  The parent FieldBattleDTO struct containing trainer data.
  * @param battler       Which battler's party is to be loaded.
+ * @param partyNARC     Open handle to the trainer party archive.
  * @param heapID        Heap on which to perform any allocations.
  */
-static void TrainerData_BuildParty(FieldBattleDTO *dto, int battler, int heapID)
+static void TrainerData_BuildParty(FieldBattleDTO *dto, int battler, NARC *partyNARC, int heapID)
 {
     // must make declarations C89-style to match
     void *buf;
@@ -189,7 +225,7 @@ static void TrainerData_BuildParty(FieldBattleDTO *dto, int battler, int heapID)
     buf = Heap_AllocFromHeap(heapID, sizeof(TrainerMonWithMovesAndItem) * MAX_PARTY_SIZE);
     mon = Pokemon_New(heapID);
 
-    Trainer_LoadParty(dto->trainerIDs[battler], buf);
+    NARC_ReadWholeMember(partyNARC, dto->trainerIDs[battler], buf);
 
     // determine which magic gender-specific modifier to use for the RNG function
     genderMod = TrainerClass_Gender(dto->trainer[battler].header.trainerType) == GENDER_FEMALE
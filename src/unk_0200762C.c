@@ -264,6 +264,22 @@ static const UnkStruct_020E4E62 Unk_020E4F4C[] = {
     { 0xff, 0xff }
 };
 
+#define SPINDA_SPOT_COUNT     4
+#define SPINDA_SPOT_MAX_WIDTH 16
+#define SPINDA_SPOT_MAX_ROWS  16
+
+// Each row holds one bit per spot pixel, spaced a nibble apart to line up
+// with the 4bpp sprite rows
+typedef struct {
+    u8 left;
+    u8 top;
+    u8 numRows;
+    u64 rows[SPINDA_SPOT_MAX_ROWS];
+} SpindaSpotMask;
+
+static SpindaSpotMask sSpindaSpotMasks[SPINDA_SPOT_COUNT];
+static BOOL sSpindaSpotMasksBuilt = FALSE;
+
 static const UnkStruct_020E4E62 *Unk_021007A4[] = {
     (UnkStruct_020E4E62 *)&Unk_020E4E62,
     (UnkStruct_020E4E62 *)&Unk_020E4DF8,
@@ -342,13 +358,13 @@ void *sub_0200762C(int param0)
 
     v7 = NARC_AllocAndReadWholeMemberByIndexPair(NARC_INDEX_POKETOOL__POKEGRA__PL_OTHERPOKE, 251, v0->unk_2E8);
     NNS_G2dGetUnpackedCharacterData(v7, &v5);
+    PokemonSprite_DecryptCharacterData(v5, NARC_INDEX_POKETOOL__POKEGRA__PL_OTHERPOKE);
 
     v0->unk_308.pixelFmt = v5->pixelFmt;
     v0->unk_308.mapingType = v5->mapingType;
     v0->unk_308.characterFmt = v5->characterFmt;
     v6 = v5->pRawData;
 
-    sub_02009348(v6);
     MI_CpuFill8(&v0->unk_2FC[0], v6[0], (32 * 32 * 0x20));
 
     for (v4 = 0; v4 < 80; v4++) {
@@ -1247,6 +1263,7 @@ static void sub_02008B78(UnkStruct_02007768 *param0)
             v5 = NARC_AllocAndReadWholeMemberByIndexPair(param0->unk_00[v1].unk_04.archive, param0->unk_00[v1].unk_04.character, param0->unk_2E8);
 
             NNS_G2dGetUnpackedCharacterData(v5, &v0);
+            PokemonSprite_DecryptCharacterData(v0, param0->unk_00[v1].unk_04.archive);
 
             param0->unk_308.pixelFmt = v0->pixelFmt;
             param0->unk_308.mapingType = v0->mapingType;
@@ -1254,7 +1271,6 @@ static void sub_02008B78(UnkStruct_02007768 *param0)
 
             v4 = v0->pRawData;
 
-            sub_020093A0(v4, param0->unk_00[v1].unk_04.archive);
             sub_020091C0(&param0->unk_00[v1], v4);
 
             if (v1 == 3) {
@@ -1433,65 +1449,104 @@ static void sub_020091C0(PokemonSprite *param0, u8 *param1)
     sub_020091D8(param1, param0->unk_04.personality, 1);
 }
 
-void sub_020091D8(u8 *param0, u32 param1, BOOL param2)
+static void BuildSpindaSpotMasks(void)
 {
     const UnkStruct_020E4E62 *v0;
-    int v1;
-    u8 v2, v3, v4;
-    int v5;
-    u32 v6;
-
-    v6 = param1;
+    SpindaSpotMask *spot;
+    int v1, v2;
+    u8 left, top;
 
-    for (v1 = 0; v1 < 4; v1++) {
+    for (v1 = 0; v1 < SPINDA_SPOT_COUNT; v1++) {
         v0 = Unk_021007A4[v1];
-        v4 = 0;
+        spot = &sSpindaSpotMasks[v1];
+        left = 0xff;
+        top = 0xff;
 
-        while (v0[v4].unk_00 != 0xff) {
-            v2 = v0[v4].unk_00 + ((param1 & 0xf) - 8);
-            v3 = v0[v4].unk_01 + (((param1 & 0xf0) >> 4) - 8);
-            v5 = v2 / 2 + v3 * 80;
+        for (v2 = 0; v0[v2].unk_00 != 0xff; v2++) {
+            left = v0[v2].unk_00 < left ? v0[v2].unk_00 : left;
+            top = v0[v2].unk_01 < top ? v0[v2].unk_01 : top;
+        }
 
-            if (v2 & 1) {
-                if (((param0[v5] & 0xf0) >= 0x10) && ((param0[v5] & 0xf0) <= 0x30)) {
-                    param0[v5] += 0x50;
-                }
-            } else {
-                if (((param0[v5] & 0xf) >= 0x1) && ((param0[v5] & 0xf) <= 0x3)) {
-                    param0[v5] += 0x5;
-                }
+        spot->left = left;
+        spot->top = top;
+        spot->numRows = 0;
+        MI_CpuClear8(spot->rows, sizeof(spot->rows));
+
+        for (v2 = 0; v0[v2].unk_00 != 0xff; v2++) {
+            GF_ASSERT(v0[v2].unk_00 - left < SPINDA_SPOT_MAX_WIDTH && v0[v2].unk_01 - top < SPINDA_SPOT_MAX_ROWS);
+
+            spot->rows[v0[v2].unk_01 - top] |= (u64)1 << ((v0[v2].unk_00 - left) * 4);
+
+            if (v0[v2].unk_01 - top >= spot->numRows) {
+                spot->numRows = v0[v2].unk_01 - top + 1;
             }
+        }
+    }
+
+    sSpindaSpotMasksBuilt = TRUE;
+}
+
+// Moves the pixels selected by mask (one bit per nibble) from colors 1-3 to 6-8
+static inline u32 ApplySpindaSpotToWord(u32 pixels, u32 mask)
+{
+    u32 lowBits = (pixels | (pixels >> 1)) & 0x11111111;
+    u32 highBits = ((pixels >> 2) | (pixels >> 3)) & 0x11111111;
+
+    return pixels + (lowBits & ~highBits & mask) * 5;
+}
+
+static void ApplySpindaSpot(u8 *pixels, const SpindaSpotMask *spot, int x, int y)
+{
+    u32 *row;
+    u64 mask;
+    int shift = (x % 8) * 4;
+    int v0;
 
-            v4++;
+    for (v0 = 0; v0 < spot->numRows; v0++) {
+        if (spot->rows[v0] == 0) {
+            continue;
         }
 
+        row = (u32 *)(pixels + (y + v0) * 80) + x / 8;
+        mask = spot->rows[v0] << shift;
+
+        row[0] = ApplySpindaSpotToWord(row[0], (u32)mask);
+        row[1] = ApplySpindaSpotToWord(row[1], (u32)(mask >> 32));
+
+        if (shift != 0) {
+            row[2] = ApplySpindaSpotToWord(row[2], (u32)(spot->rows[v0] >> (64 - shift)));
+        }
+    }
+}
+
+void sub_020091D8(u8 *param0, u32 param1, BOOL param2)
+{
+    const SpindaSpotMask *spot;
+    int v1;
+    u32 v6;
+
+    // Sprite rows are 4bpp, so pixel x of a row is nibble x of its little-endian words
+    GF_ASSERT(((u32)param0 & 3) == 0);
+
+    if (!sSpindaSpotMasksBuilt) {
+        BuildSpindaSpotMasks();
+    }
+
+    v6 = param1;
+
+    for (v1 = 0; v1 < SPINDA_SPOT_COUNT; v1++) {
+        spot = &sSpindaSpotMasks[v1];
+        ApplySpindaSpot(param0, spot, spot->left + (param1 & 0xf) - 8, spot->top + ((param1 & 0xf0) >> 4) - 8);
+
         param1 = param1 >> 8;
     }
 
     param1 = v6;
 
     if (param2) {
-        for (v1 = 0; v1 < 4; v1++) {
-            v0 = Unk_021007A4[v1];
-            v4 = 0;
-
-            while (v0[v4].unk_00 != 0xff) {
-                v2 = (v0[v4].unk_00 - 14) + ((param1 & 0xf) - 8) + 80;
-                v3 = v0[v4].unk_01 + (((param1 & 0xf0) >> 4) - 8);
-                v5 = v2 / 2 + v3 * 80;
-
-                if (v2 & 1) {
-                    if (((param0[v5] & 0xf0) >= 0x10) && ((param0[v5] & 0xf0) <= 0x30)) {
-                        param0[v5] += 0x50;
-                    }
-                } else {
-                    if (((param0[v5] & 0xf) >= 0x1) && ((param0[v5] & 0xf) <= 0x3)) {
-                        param0[v5] += 0x5;
-                    }
-                }
-
-                v4++;
-            }
+        for (v1 = 0; v1 < SPINDA_SPOT_COUNT; v1++) {
+            spot = &sSpindaSpotMasks[v1];
+            ApplySpindaSpot(param0, spot, (spot->left - 14) + (param1 & 0xf) - 8 + 80, spot->top + ((param1 & 0xf0) >> 4) - 8);
 
             param1 = param1 >> 8;
         }
@@ -1542,3 +1597,15 @@ void sub_020093A0(u8 *param0, int param1)
         sub_02009348(param0);
     }
 }
+
+void PokemonSprite_DecryptCharacterData(NNSG2dCharacterData *charData, int narcID)
+{
+    // Sprites packed with make_pl_pokegra.py --predecrypt are stored in the
+    // clear and carry this flag instead
+    if (charData->characterFmt & CHARACTER_FMT_PREDECRYPTED) {
+        charData->characterFmt &= ~CHARACTER_FMT_PREDECRYPTED;
+        return;
+    }
+
+    sub_020093A0(charData->pRawData, narcID);
+}
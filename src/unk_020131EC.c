@@ -103,7 +103,7 @@ static void sub_02013338(int param0, int param1, int param2, int param3, int par
     NNSG2dCharacterData *v1 = NULL;
 
     sub_0201322C(param0, param1, param2, &v1);
-    sub_020093A0(v1->pRawData, param0);
+    PokemonSprite_DecryptCharacterData(v1, param0);
 
     v0 = sub_020132F8(param11);
 
@@ -151,7 +151,7 @@ void sub_020133D4(int param0, int param1, int param2, int param3, int param4, in
     v5 = (sizeof(u8) * 4);
     v1 = v3->pRawData;
 
-    sub_020093A0(v1, param0);
+    PokemonSprite_DecryptCharacterData(v3, param0);
 
     v2 = (u8 *)param7;
     v8 = (v3->W * v5);
@@ -44,6 +44,24 @@ BOOL CommQueue_IsEmpty(CommQueueMan *param0)
     return 1;
 }
 
+#ifdef COMM_SEND_STATS
+int CommQueue_NumPending(CommQueueMan *queue)
+{
+    UnkStruct_020322D8 *entry = queue->unk_18;
+    int i, count = 0;
+
+    for (i = 0; i < queue->unk_1C; i++) {
+        if (entry->unk_0E != 0) {
+            count++;
+        }
+
+        entry++;
+    }
+
+    return count;
+}
+#endif // COMM_SEND_STATS
+
 static BOOL sub_02032318(UnkStruct_02032318 *param0)
 {
     if (param0->unk_00 != NULL) {
@@ -8,10 +8,19 @@
 
 #include "heap.h"
 
+typedef struct VramTransferRequest {
+    NNS_GFD_DST_TYPE type;
+    u32 destAddr;
+    u8 *buf;
+    u32 size;
+} VramTransferRequest;
+
 typedef struct VramTransferTaskManager {
     u32 max;
     u32 cur;
     NNSGfdVramTransferTask *tasks;
+    VramTransferRequest *requests;
+    VramTransferStats stats;
 } VramTransferTaskManager;
 
 static VramTransferTaskManager *sTransferTaskManager;
@@ -23,8 +32,10 @@ void VramTransfer_New(u32 capacity, enum HeapId heapID)
     GF_ASSERT(sTransferTaskManager);
 
     sTransferTaskManager->tasks = Heap_AllocFromHeap(heapID, sizeof(NNSGfdVramTransferTask) * capacity);
+    sTransferTaskManager->requests = Heap_AllocFromHeap(heapID, sizeof(VramTransferRequest) * capacity);
     sTransferTaskManager->max = capacity;
     sTransferTaskManager->cur = 0;
+    VramTransfer_ResetStats();
 
     NNS_GfdInitVramTransferManager(sTransferTaskManager->tasks, sTransferTaskManager->max);
 }
@@ -33,29 +44,127 @@ void VramTransfer_Free(void)
 {
     GF_ASSERT(sTransferTaskManager != NULL);
 
+    Heap_FreeToHeap(sTransferTaskManager->requests);
     Heap_FreeToHeap(sTransferTaskManager->tasks);
     Heap_FreeToHeap(sTransferTaskManager);
 
     sTransferTaskManager = NULL;
 }
 
+static BOOL DoRangesOverlap(u32 start1, u32 size1, u32 start2, u32 size2)
+{
+    return start1 < start2 + size2 && start2 < start1 + size1;
+}
+
+/*
+ * Folds a new request into one that is already queued, when the two copy the
+ * same source to the same destination or continue each other in both source
+ * and destination. The search walks back from the newest request and stops at
+ * the first one that overlaps the new range, so transfers never swap order.
+ */
+static BOOL TryMergeRequest(NNS_GFD_DST_TYPE type, u32 destAddr, u8 *buf, u32 size)
+{
+    VramTransferRequest *request;
+
+    for (int i = sTransferTaskManager->cur - 1; i >= 0; i--) {
+        request = &sTransferTaskManager->requests[i];
+
+        if (request->type != type) {
+            continue;
+        }
+
+        if (request->destAddr == destAddr && request->buf == buf && request->size >= size) {
+            return TRUE;
+        }
+
+        if (request->destAddr + request->size == destAddr && request->buf + request->size == buf) {
+            request->size += size;
+            return TRUE;
+        }
+
+        if (destAddr + size == request->destAddr && buf + size == request->buf) {
+            request->destAddr = destAddr;
+            request->buf = buf;
+            request->size += size;
+            return TRUE;
+        }
+
+        if (DoRangesOverlap(request->destAddr, request->size, destAddr, size)) {
+            return FALSE;
+        }
+    }
+
+    return FALSE;
+}
+
 BOOL VramTransfer_Request(NNS_GFD_DST_TYPE type, u32 destAddr, void *buf, u32 size)
 {
     GF_ASSERT(sTransferTaskManager);
-    sTransferTaskManager->cur++;
 
+    VramTransferStats *stats = &sTransferTaskManager->stats;
+
+    if (TryMergeRequest(type, destAddr, buf, size)) {
+        stats->curBytes += size;
+        stats->mergedRequests++;
+        return TRUE;
+    }
+
+    // An overloaded frame drops the request rather than halting; the caller
+    // sees FALSE and the drop is counted
     if (sTransferTaskManager->cur >= sTransferTaskManager->max) {
-        GF_ASSERT(FALSE);
+        stats->droppedRequests++;
         return FALSE;
     }
 
-    return NNS_GfdRegisterNewVramTransferTask(type, destAddr, buf, size);
+    VramTransferRequest *request = &sTransferTaskManager->requests[sTransferTaskManager->cur];
+    request->type = type;
+    request->destAddr = destAddr;
+    request->buf = buf;
+    request->size = size;
+
+    sTransferTaskManager->cur++;
+    stats->curBytes += size;
+
+    if (sTransferTaskManager->cur > stats->peakTasks) {
+        stats->peakTasks = sTransferTaskManager->cur;
+    }
+
+    return TRUE;
 }
 
 void VramTransfer_Process(void)
 {
     if (sTransferTaskManager) {
+        VramTransferRequest *request;
+        VramTransferStats *stats = &sTransferTaskManager->stats;
+
+        for (u32 i = 0; i < sTransferTaskManager->cur; i++) {
+            request = &sTransferTaskManager->requests[i];
+            NNS_GfdRegisterNewVramTransferTask(request->type, request->destAddr, request->buf, request->size);
+        }
+
         NNS_GfdDoVramTransfer();
+
+        stats->lastFrameTasks = sTransferTaskManager->cur;
+        stats->lastFrameBytes = stats->curBytes;
+
+        if (stats->curBytes > stats->peakBytes) {
+            stats->peakBytes = stats->curBytes;
+        }
+
+        stats->curBytes = 0;
         sTransferTaskManager->cur = 0;
     }
 }
+
+void VramTransfer_GetStats(VramTransferStats *stats)
+{
+    GF_ASSERT(sTransferTaskManager);
+    *stats = sTransferTaskManager->stats;
+}
+
+void VramTransfer_ResetStats(void)
+{
+    GF_ASSERT(sTransferTaskManager);
+    memset(&sTransferTaskManager->stats, 0, sizeof(VramTransferStats));
+}
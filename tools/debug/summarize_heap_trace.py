@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+
+### This tool summarises a heap trace written by Heap_TraceDump (in a build configured with
+### -Dheap_tracing=true). Such builds print the dump to the emulator log every 600 frames; given a
+### log with several dumps, the last one is summarised. It prints per-heap usage and allocation
+### rates, then the allocation sites with the most churn. If the linker's xMAP file is given,
+### caller addresses are resolved to function names.
+import argparse
+import re
+
+from xmap_symbols import SymbolTable
+
+argparser = argparse.ArgumentParser(
+    prog='summarize_heap_trace.py',
+    description='Summarises heap allocation traces dumped by Heap_TraceDump'
+)
+argparser.add_argument('trace_file',
+                       help='Emulator log or text dump containing Heap_TraceDump output')
+argparser.add_argument('-m', '--map',
+                       help='Path to the linker map (main.nef.xMAP) used to name call sites')
+argparser.add_argument('-n', '--sites',
+                       type=int,
+                       default=20,
+                       help='Number of call sites to list (default: 20)')
+args = argparser.parse_args()
+
+FIELD = re.compile(r'(\w+)=([0-9A-Fa-f]+)')
+
+symbols = SymbolTable(args.map)
+
+def fields(line, hex_keys=()):
+    return {key: int(value, 16 if key in hex_keys else 10) for key, value in FIELD.findall(line)}
+
+frames = 0
+heaps = []
+sites = []
+with open(args.trace_file) as f:
+    for line in f:
+        # Each dump is cumulative, so a new one replaces what was read so far
+        if 'HEAPTRACE ' in line:
+            frames = fields(line)['frames']
+            heaps = []
+            sites = []
+        elif 'HEAP id=' in line:
+            heaps.append(fields(line))
+        elif 'SITE heap=' in line:
+            sites.append(fields(line, hex_keys=('caller',)))
+
+per_frame = lambda count: count / frames if frames else 0.0
+
+print(f'{frames} frames traced\n')
+print(f'{"heap":>4} {"live":>9} {"peak":>9} {"free":>9} {"largest":>9} {"frag%":>6} {"allocs/f":>9} {"fails":>6}')
+for heap in heaps:
+    frag = 100.0 * (1 - heap['largest'] / heap['free']) if heap['free'] else 0.0
+    print(f'{heap["id"]:>4} {heap["live"]:>9} {heap["peak"]:>9} {heap["free"]:>9} {heap["largest"]:>9} '
+          f'{frag:>6.1f} {per_frame(heap["allocs"]):>9.2f} {heap["fails"]:>6}')
+
+print(f'\n{"heap":>4} {"allocs":>8} {"allocs/f":>9} {"bytes":>10}  site')
+for site in sorted(sites, key=lambda site: site['allocs'], reverse=True)[:args.sites]:
+    print(f'{site["heap"]:>4} {site["allocs"]:>8} {per_frame(site["allocs"]):>9.2f} {site["bytes"]:>10}  '
+          f'{site["caller"]:08X} {symbols.symbolize(site["caller"])}')
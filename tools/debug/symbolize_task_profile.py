@@ -0,0 +1,35 @@
+#!/usr/bin/env python3
+
+### This tool resolves the callback addresses in SYSTASK profile lines (printed by a build
+### configured with -Dtask_profiling=true) to function names, using the linker's xMAP file.
+### Overlays share address ranges, so an address may resolve to several candidates; all of them
+### are listed, separated by '|'.
+import argparse
+import re
+import sys
+
+from xmap_symbols import SymbolTable
+
+argparser = argparse.ArgumentParser(
+    prog='symbolize_task_profile.py',
+    description='Symbolises SysTask profile reports against the linker map'
+)
+argparser.add_argument('map_file',
+                       help='Path to the linker map (main.nef.xMAP)')
+argparser.add_argument('log_file',
+                       nargs='?',
+                       help='Emulator log containing SYSTASK lines (defaults to stdin)')
+args = argparser.parse_args()
+
+FUNC_FIELD = re.compile(r'func=([0-9A-Fa-f]{8})')
+
+symbols = SymbolTable(args.map_file)
+
+def replace_func(match):
+    return f'func={match.group(1)} ({symbols.symbolize(int(match.group(1), 16))})'
+
+log = open(args.log_file) if args.log_file else sys.stdin
+for line in log:
+    if 'SYSTASK' in line:
+        line = FUNC_FIELD.sub(replace_func, line)
+    sys.stdout.write(line)
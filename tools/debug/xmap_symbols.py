@@ -0,0 +1,53 @@
+### Shared helpers for the debug tools that turn code addresses into function names using the
+### linker's xMAP file (main.nef.xMAP). Overlays share address ranges, so an address may resolve
+### to several candidates; all of them are returned, separated by '|'.
+import bisect
+import re
+
+# Text symbols in the map look like:
+#   02000800 000000A4 .text     FunctionName	(file.o)
+SYMBOL_LINE = re.compile(r'^\s+([0-9A-Fa-f]{8})\s+([0-9A-Fa-f]{8})\s+\.text\s+(\S+)')
+
+# No function is this large, so the backwards search for overlapping
+# overlay candidates can stop once it gets this far from the address
+MAX_FUNCTION_SIZE = 0x10000
+
+UNRESOLVED = '?'
+
+
+class SymbolTable:
+    def __init__(self, map_path=None):
+        self.symbols = []
+
+        if map_path is not None:
+            with open(map_path) as f:
+                for line in f:
+                    match = SYMBOL_LINE.match(line)
+                    if match is None:
+                        continue
+
+                    start = int(match.group(1), 16)
+                    size = int(match.group(2), 16)
+                    if size > 0:
+                        self.symbols.append((start, size, match.group(3)))
+
+        self.symbols.sort()
+        self.starts = [symbol[0] for symbol in self.symbols]
+
+    def symbolize(self, address):
+        # Thumb code addresses have the low bit set
+        address &= ~1
+        names = []
+
+        i = bisect.bisect_right(self.starts, address) - 1
+        while i >= 0:
+            start, size, name = self.symbols[i]
+            if address - start > MAX_FUNCTION_SIZE:
+                break
+
+            if start + size > address:
+                offset = address - start
+                names.append(name if offset == 0 else f'{name}+0x{offset:X}')
+            i -= 1
+
+        return '|'.join(names) if names else UNRESOLVED
@@ -3,6 +3,7 @@
 import argparse
 import pathlib
 import shutil
+import struct
 import subprocess
 
 argparser = argparse.ArgumentParser(
@@ -24,6 +25,9 @@ argparser.add_argument('-p', '--private-dir',
 argparser.add_argument('-o', '--output-dir',
                        required=True,
                        help='Path to the output directory (where the NARC will be made)')
+argparser.add_argument('--predecrypt',
+                       action='store_true',
+                       help='Store sprite pixels decrypted, so they load without the runtime cipher pass')
 argparser.add_argument('subdirs',
                        nargs='+',
                        help='List of subdirectories to process in-order')
@@ -35,6 +39,31 @@ output_dir = pathlib.Path(args.output_dir)
 
 private_dir.mkdir(parents=True, exist_ok=True)
 
+# Must match CHARACTER_FMT_PREDECRYPTED in include/unk_0200762C.h
+CHARACTER_FMT_PREDECRYPTED = 1 << 30
+SPRITE_HALFWORDS = (20 * 10 * 0x20) // 2
+
+def predecrypt_ncgr(path):
+    data = bytearray(path.read_bytes())
+    if not data:
+        return
+
+    # The character data header follows the generic file header and the
+    # 8-byte CHAR block header; its raw data offset is relative to itself
+    char_data = struct.unpack_from('<H', data, 0x0C)[0] + 8
+    char_fmt, _, raw_offset = struct.unpack_from('<III', data, char_data + 0x0C)
+    pixels = char_data + raw_offset
+
+    # Mirrors the front-to-back cipher in sub_02009348
+    state = struct.unpack_from('<H', data, pixels)[0]
+    for i in range(SPRITE_HALFWORDS):
+        offset = pixels + i * 2
+        struct.pack_into('<H', data, offset, struct.unpack_from('<H', data, offset)[0] ^ (state & 0xFFFF))
+        state = (state * 1103515245 + 24691) & 0xFFFFFFFF
+
+    struct.pack_into('<I', data, char_data + 0x0C, char_fmt | CHARACTER_FMT_PREDECRYPTED)
+    path.write_bytes(data)
+
 for i, subdir in enumerate(args.subdirs):
     # Do not attempt to process either egg or bad_egg
     if subdir in ['egg', 'bad_egg']:
@@ -53,6 +82,9 @@ for i, subdir in enumerate(args.subdirs):
                     target_file,
                     '-scanfronttoback'
                 ])
+
+                if args.predecrypt:
+                    predecrypt_ncgr(target_file)
             else:
                 subprocess.run(['touch', target_file])
 